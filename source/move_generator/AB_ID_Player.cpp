@@ -3,55 +3,57 @@
 //
 
 #include <iostream>
-#include <cassert>
 #include <chrono>
 #include "AB_ID_Player.h"
+#include "Move_Picker.h"
 
 std::string AB_ID_Player::get_move_string(const std::string &state_string) {
-  State_t root_state = parse_input(state_string);
+  Board root_state = parse_input(state_string);
+  Position root_position(root_state, zobrist_table);
   // Set the time limit for this move
   set_time_limit(root_state);
   my_player_color = root_state[PLAYER_ON_MOVE];
   Move current_move;
 
-  int num_nodes = 0;
+  number_of_nodes = 0;
   int depth = 1;
   int alpha = std::numeric_limits<int>::min();
   int beta = std::numeric_limits<int>::max();
 
-  Negamax_Result root_result = negamax(root_state, depth, alpha, beta, num_nodes);
+  Negamax_Result root_result = negamax(root_position, depth, alpha, beta, number_of_nodes);
 
-  while(root_state[MOVE_NUMBER] + ++depth <= 41) {
-    Negamax_Result candidate_result = negamax(root_state, depth, alpha, beta, num_nodes);
+  while (root_state[MOVE_NUMBER] + ++depth <= 41 && (!depth_limit || depth <= depth_limit)) {
+    Negamax_Result candidate_result = negamax(root_position, depth, alpha, beta, number_of_nodes);
     // Sense timeout conditions
-    if (get_millisecond_time() > timelimit || candidate_result.get_move_string() == "XXX") {
+    if (get_millisecond_time() > timelimit || candidate_result.isTimeout()) {
       --depth; // for printing purposes
       break;
     }
 
     // Short circuit on a loss.
     if (candidate_result.isLoss()) {
-      return root_result.get_move_string();
+      return to_move_string(root_state, root_result.get_move());
     }
 
     // Short circuit on a win
     if (candidate_result.isWin()) {
-      return candidate_result.get_move_string();
+      return to_move_string(root_state, candidate_result.get_move());
     }
 
     root_result = candidate_result;
   }
 
-  std::cerr << "Returning move_string " << root_result.get_move_string()
+  std::cerr << "Returning move_string " << to_move_string(root_state, root_result.get_move())
             << " with value " << root_result.get_value()
-            << ". Nodes evaluated: " << num_nodes
+            << ". Nodes evaluated: " << number_of_nodes
             << " Depth: " << depth << std::endl;
 
-  return root_result.get_move_string();
+  return to_move_string(root_state, root_result.get_move());
 }
 
-Negamax_Result AB_ID_Player::negamax(const State_t &state, int depth, int alpha, int beta, int &node_count) {
+Negamax_Result AB_ID_Player::negamax(Position &position, int depth, int alpha, int beta, int &node_count) {
   using namespace std::chrono;
+  const Board &state = position.get_board();
   ++node_count;
   ++timecounter;
 
@@ -61,11 +63,13 @@ Negamax_Result AB_ID_Player::negamax(const State_t &state, int depth, int alpha,
   }
 
   if(timecache > timelimit) {
-    return Negamax_Result(0, "XXX");
+    Negamax_Result result;
+    result.setTimeout(true);
+    return result;
   }
 
   if (depth == 0 || is_terminal(state)) {
-    Negamax_Result result(eval(state), "");
+    Negamax_Result result(eval(position));
     // This state is a loss if my king is missing.
     result.setLoss(state[my_king_index[my_player_color]] == 0ul);
     // This state is a win if my opponent's king is missing
@@ -76,20 +80,20 @@ Negamax_Result AB_ID_Player::negamax(const State_t &state, int depth, int alpha,
 
   Negamax_Result result;
 
-  // children <- legal moves from state
-  std::vector<Move> children = generate_all_moves(state);
-  assert (children.size() > 0);
+  // children <- legal moves from state, handed out best first
+  Move_Picker children(position, Move());
 
   // extract some move child from children
-  Move child = children.front();
-  children.erase(children.begin());
-
-  // Make the move
-  State_t child_state = make_move(state, child);
+  Move child;
+  if (!children.next(child)) {
+    return Negamax_Result(eval(position));
+  }
 
-  // Get the negamax value of that move
-  result = -negamax(child_state, depth - 1, -beta, -alpha, node_count);
-  result.set_move_string(child.get_move_string());
+  // Make the move and get the negamax value of that move
+  position.do_move(child);
+  result = -negamax(position, depth - 1, -beta, -alpha, node_count);
+  position.undo_move();
+  result.set_move(child);
 
   int best_value = result.get_value();
 
@@ -101,10 +105,11 @@ Negamax_Result AB_ID_Player::negamax(const State_t &state, int depth, int alpha,
   // a <- max(a, child result value)
   alpha = std::max(alpha, result.get_value());
 
-  for (Move child : children) {
-    child_state = make_move(state, child);
-    Negamax_Result child_result = -negamax(child_state, depth - 1, -beta, -alpha, node_count);
-    child_result.set_move_string(child.get_move_string());
+  while (children.next(child)) {
+    position.do_move(child);
+    Negamax_Result child_result = -negamax(position, depth - 1, -beta, -alpha, node_count);
+    position.undo_move();
+    child_result.set_move(child);
 
     if (child_result.get_value() >= beta) {
       result = child_result;
@@ -22,14 +22,14 @@ private:
    * the get_move_string function. The negamax function provides a method
    * for interrupting the function when time has expired.
    *
-   * @param state The vector of unsigned ints that is the game state
+   * @param position The game state, played on in place and restored before returning.
    * @param depth The desired depth of the negamax search.
    * @param alpha
    * @param beta
    * @param node_count
    * @return
    */
-  Negamax_Result negamax(const State_t &state, int depth, int alpha, int beta, int &node_count);
+  Negamax_Result negamax(Position &position, int depth, int alpha, int beta, int &node_count);
 };
 
 
@@ -3,55 +3,78 @@
 //
 
 #include <iostream>
-#include <cassert>
+#include <iomanip>
 #include <chrono>
+#include <sstream>
 #include "AB_ID_TT_Player.h"
+#include "Move_Picker.h"
+
+AB_ID_TT_Player::AB_ID_TT_Player(std::size_t hash_mb, const std::string &hash_file) : table(hash_mb, hash_file) {
+  std::cerr << "Transposition table: " << (table.get_size() >> 20) << " MB in "
+            << (table.get_size() / sizeof(TTable_Bucket)) << " buckets";
+  if (table.isPersistent()) {
+    std::cerr << " kept in " << hash_file << std::endl;
+  } else {
+    std::cerr << ", " << (table.get_huge_page_size() >> 20) << " MB of it in huge pages" << std::endl;
+    if (!hash_file.empty()) {
+      std::cerr << "Could not keep the transposition table in " << hash_file << std::endl;
+    }
+  }
+}
 
 std::string AB_ID_TT_Player::get_move_string(const std::string &state_string) {
-  State_t root_state = parse_input(state_string);
+  Board root_state = parse_input(state_string);
+  Position root_position(root_state, zobrist_table);
   // Set the time limit for this move
   set_time_limit(root_state);
   my_player_color = root_state[PLAYER_ON_MOVE];
+  // Entries from earlier moves are kept but replaced first
+  table.new_search();
+  eval_cache.clear_stats();
   Move current_move;
 
-  int num_nodes = 0;
+  number_of_nodes = 0;
   int depth = 1;
-  int alpha = std::numeric_limits<int>::min();
+  int alpha = -std::numeric_limits<int>::max();
   int beta = std::numeric_limits<int>::max();
 
-  Negamax_Result root_result = negamax(root_state, depth, alpha, beta, num_nodes);
+  Negamax_Result root_result = negamax(root_position, depth, alpha, beta, number_of_nodes);
+  // The depth root_result was searched to
+  int result_depth = depth;
 
-  while (root_state[MOVE_NUMBER] + ++depth <= 41) {
-    Negamax_Result candidate_result = negamax(root_state, depth, alpha, beta, num_nodes);
+  while (root_state[MOVE_NUMBER] + ++depth <= 41 && (!depth_limit || depth <= depth_limit)) {
+    Negamax_Result candidate_result = negamax(root_position, depth, alpha, beta, number_of_nodes);
     // Sense timeout conditions
-    if (get_millisecond_time() > timelimit || candidate_result.get_move_string() == "XXX") {
-      --depth; // for printing purposes
+    if (get_millisecond_time() > timelimit || candidate_result.isTimeout()) {
       break;
     }
 
-    // Short circuit on a loss.
+    // Short circuit on a loss, keeping the move of the last iteration
     if (candidate_result.isLoss()) {
-      return root_result.get_move_string();
+      break;
     }
 
+    root_result = candidate_result;
+    result_depth = depth;
+
     // Short circuit on a win
     if (candidate_result.isWin()) {
-      return candidate_result.get_move_string();
+      break;
     }
-
-    root_result = candidate_result;
   }
 
-  std::cerr << "Returning move_string " << root_result.get_move_string()
+  std::cerr << "Returning move_string " << to_move_string(root_state, root_result.get_move())
             << " with value " << root_result.get_value()
-            << ". Nodes evaluated: " << num_nodes
-            << " Depth: " << depth << std::endl;
+            << ". Nodes evaluated: " << number_of_nodes
+            << " Depth: " << result_depth << std::endl;
+  report_table_stats(to_move_string(root_state, root_result.get_move()), root_result.get_value(), result_depth);
 
-  return root_result.get_move_string();
+  return to_move_string(root_state, root_result.get_move());
 }
 
-Negamax_Result AB_ID_TT_Player::negamax(const State_t &state, int depth, int alpha, int beta, int &node_count) {
+Negamax_Result AB_ID_TT_Player::negamax(Position &position, int depth, int alpha, int beta, int &node_count) {
   using namespace std::chrono;
+  const Board &state = position.get_board();
   ++node_count;
   ++timecounter;
 
@@ -61,29 +84,42 @@ Negamax_Result AB_ID_TT_Player::negamax(const State_t &state, int depth, int alp
   }
 
   if (timecache > timelimit) {
-    return Negamax_Result(0, "XXX");
+    Negamax_Result result;
+    result.setTimeout(true);
+    return result;
   }
 
   int alpha_orig = alpha;
-  State_t best_state;
+  Move best_move;
 
-  TTable_Entry ttentry = table.get_entry(state);
+  unsigned long long key = table_key(position.get_hash(), state[MOVE_NUMBER]);
+  TTable_Entry ttentry = table.get_entry(key);
+  bool terminal = is_terminal(state);
+  // The game ends at move 41, so an entry searched deeper than that from
+  // here saw past the end, and its value isn't this state's
+  int horizon = 41 - static_cast<int>(state[MOVE_NUMBER]);
 
-  if (ttentry.isValid() && ttentry.getDepth() >= depth) {
+  // The root has to return a move, so only the value of a child can come from
+  // the table. A terminal state is always scored by eval, so that its result
+  // carries the win and loss flags the table doesn't keep.
+  if (ttentry.isValid() && ttentry.getDepth() >= depth && ttentry.getDepth() <= horizon
+      && position.get_ply() > 0 && !terminal) {
     if (ttentry.getFlag() == EXACT_VALUE) {
-      return Negamax_Result(ttentry.getValue(), "");
+      table.record_cutoff(EXACT_VALUE);
+      return Negamax_Result(ttentry.getValue());
     } else if (ttentry.getFlag() == LOWER_BOUND) {
       alpha = std::max(alpha, ttentry.getValue());
     } else if (ttentry.getFlag() == UPPER_BOUND) {
       beta = std::min(beta, ttentry.getValue());
     }
     if (alpha >= beta) {
-      return Negamax_Result(ttentry.getValue(), "");
+      table.record_cutoff(ttentry.getFlag());
+      return Negamax_Result(ttentry.getValue());
     }
   }
 
-  if (depth == 0 || is_terminal(state)) {
-    Negamax_Result result(eval(state), "");
+  if (depth == 0 || terminal) {
+    Negamax_Result result(eval(position));
     // This state is a loss if my king is missing.
     result.setLoss(state[my_king_index[my_player_color]] == 0ul);
     // This state is a win if my opponent's king is missing
@@ -94,46 +130,59 @@ Negamax_Result AB_ID_TT_Player::negamax(const State_t &state, int depth, int alp
 
   Negamax_Result result;
 
-  // children <- legal moves from state
-  std::vector<Move> children = generate_all_moves(state);
-  assert (children.size() > 0);
+  // children <- legal moves from state, handed out best first, starting
+  // with the best move the table has for this state from an earlier search
+  Move_Picker children(position, ttentry.isValid() ? ttentry.getMove() : Move());
 
   // extract some move child from children
-  Move child = children.front();
-  children.erase(children.begin());
-
-  // Make the move
-  State_t child_state = make_move(state, child);
-
-  // Get the negamax value of that move
-  result = -negamax(child_state, depth - 1, -beta, -alpha, node_count);
-  result.set_move_string(child.get_move_string());
+  Move child;
+  unsigned long long child_hash = 0ull;
+  if (!pick_child(children, position, false, child, child_hash)) {
+    return Negamax_Result(eval(position));
+  }
 
-  int best_value = result.get_value();
-  best_state = child_state;
+  // If the picker already holds the next child, its bucket is fetched while
+  // this one is searched
+  unsigned long long next_hash = 0ull;
+  bool fetched = fetch_next(children, position, next_hash);
 
-  // if result's value > beta, return child result
-  if (best_value > beta) {
+  // Make the move and get the negamax value of that move
+  position.do_move(child, child_hash);
+  result = -negamax(position, depth - 1, -beta, -alpha, node_count);
+  position.undo_move();
+  result.set_move(child);
+  if (result.isTimeout()) {
     return result;
   }
 
+  int best_value = result.get_value();
+  best_move = child;
+
   // a <- max(a, child result value)
   alpha = std::max(alpha, result.get_value());
 
-  for (Move child : children) {
-    child_state = make_move(state, child);
-    Negamax_Result child_result = -negamax(child_state, depth - 1, -beta, -alpha, node_count);
-    child_result.set_move_string(child.get_move_string());
+  // if result's value > beta, the rest of the children can be skipped
+  while (best_value <= beta && pick_child(children, position, fetched, child, next_hash)) {
+    child_hash = next_hash;
+    fetched = fetch_next(children, position, next_hash);
+    position.do_move(child, child_hash);
+    Negamax_Result child_result = -negamax(position, depth - 1, -beta, -alpha, node_count);
+    position.undo_move();
+    child_result.set_move(child);
+    if (child_result.isTimeout()) {
+      return child_result;
+    }
 
     if (child_result.get_value() >= beta) {
       result = child_result;
-      return result;
+      best_move = child;
+      break;
     }
 
     if (child_result.get_value() > best_value) {
       best_value = child_result.get_value();
       result = child_result;
-      best_state = child_state;
+      best_move = child;
     }
 
     alpha = std::max(alpha, child_result.get_value());
@@ -148,7 +197,87 @@ Negamax_Result AB_ID_TT_Player::negamax(const State_t &state, int depth, int alp
     ttentry.setFlag(EXACT_VALUE);
   }
   ttentry.setDepth(depth);
-  table.insert(ttentry, best_state);
+  ttentry.setMove(best_move);
+  ttentry.setValid(true);
+  table.insert(ttentry, key);
 
   return result;
 }
+
+bool AB_ID_TT_Player::pick_child(Move_Picker &children, const Position &position, bool fetched, Move &child,
+                                 unsigned long long &child_hash) {
+  if (!children.next(child)) {
+    return false;
+  }
+  if (!fetched) {
+    child_hash = position.get_hash_after(child);
+    if (prefetch) {
+      table.prefetch(table_key(child_hash, position[MOVE_NUMBER] + 1));
+    }
+  }
+  return true;
+}
+
+bool AB_ID_TT_Player::fetch_next(Move_Picker &children, const Position &position, unsigned long long &next_hash) {
+  Move next_child;
+  if (!prefetch || !children.peek(next_child)) {
+    return false;
+  }
+  next_hash = position.get_hash_after(next_child);
+  table.prefetch(table_key(next_hash, position[MOVE_NUMBER] + 1));
+  return true;
+}
+
+unsigned long long AB_ID_TT_Player::table_key(unsigned long long hash, unsigned int move_number) const {
+  return hash ^ zobrist_table.get_phase_key(game_phase(move_number));
+}
+
+void AB_ID_TT_Player::set_prefetch(bool enabled) {
+  prefetch = enabled;
+}
+
+void AB_ID_TT_Player::report_table_stats(const std::string &move_string, int value, int depth) {
+#ifndef NO_TTABLE_STATS
+  const TTable_Stats &stats = table.get_stats();
+  double hit_rate = stats.probes ? 100.0 * stats.hits / stats.probes : 0.0;
+  double fill = table.get_fill(false);
+  double current_fill = table.get_fill(true);
+  unsigned long long eval_probes = eval_cache.get_probes();
+  unsigned long long eval_hits = eval_cache.get_hits();
+  double eval_hit_rate = eval_probes ? 100.0 * eval_hits / eval_probes : 0.0;
+  // Formatted on its own stream so that the precision doesn't stick to std::cerr
+  std::ostringstream report;
+  report << std::fixed << std::setprecision(1)
+         << "TTable probes: " << stats.probes
+         << " hits: " << stats.hits << " (" << hit_rate << "%)"
+         << " key rejects: " << stats.key_rejects
+         << " stores: " << stats.stores
+         << " replacements: " << stats.replacements
+         << " kept deeper: " << stats.kept_deeper
+         << " fill: " << fill << "% (" << current_fill << "% this move)"
+         << " cutoffs exact/lower/upper: " << stats.exact_cutoffs << "/" << stats.lower_cutoffs
+         << "/" << stats.upper_cutoffs
+         << " eval cache probes: " << eval_probes
+         << " hits: " << eval_hits << " (" << eval_hit_rate << "%)" << std::endl;
+  // The same, one JSON object per move for scripts
+  report << "{\"move\":\"" << move_string << "\""
+         << ",\"value\":" << value
+         << ",\"nodes\":" << number_of_nodes
+         << ",\"depth\":" << depth
+         << ",\"tt_size\":" << table.get_size()
+         << ",\"tt_probes\":" << stats.probes
+         << ",\"tt_hits\":" << stats.hits
+         << ",\"tt_key_rejects\":" << stats.key_rejects
+         << ",\"tt_stores\":" << stats.stores
+         << ",\"tt_replacements\":" << stats.replacements
+         << ",\"tt_kept_deeper\":" << stats.kept_deeper
+         << ",\"tt_fill\":" << fill
+         << ",\"tt_current_fill\":" << current_fill
+         << ",\"tt_exact_cutoffs\":" << stats.exact_cutoffs
+         << ",\"tt_lower_cutoffs\":" << stats.lower_cutoffs
+         << ",\"tt_upper_cutoffs\":" << stats.upper_cutoffs
+         << ",\"eval_probes\":" << eval_probes
+         << ",\"eval_hits\":" << eval_hits << "}" << std::endl;
+  std::cerr << report.str();
+#endif
+}
@@ -6,6 +6,7 @@
 #define MOVE_GENERATOR_AB_ID_TT_PLAYER_H
 
 
+#include "Move_Picker.h"
 #include "Player.h"
 #include "Negamax_Result.h"
 #include "TTable.h"
@@ -15,6 +16,13 @@
  */
 class AB_ID_TT_Player : public Player {
 public:
+  /**
+   * @param hash_mb The most memory the transposition table may use, in megabytes.
+   * @param hash_file The file to keep the transposition table in between
+   *                  games, or empty to start every game with an empty table.
+   */
+  explicit AB_ID_TT_Player(std::size_t hash_mb = TTABLE_DEFAULT_MB, const std::string &hash_file = "");
+
   /**
    * Implements the base Player get_move_string interface.
    *
@@ -23,18 +31,79 @@ public:
    */
   std::string get_move_string(const std::string &state_string) override;
 
+  /**
+   * Turn prefetching the table entries of children on or off. It is on by
+   * default; turning it off is for measuring what it saves.
+   *
+   * @param enabled
+   */
+  void set_prefetch(bool enabled);
+
 private:
   /**
    * The negamax function for this player.
    *
-   * @param state
+   * @param position
    * @param depth
    * @param alpha
    * @param beta
    * @param node_count
    * @return
    */
-  Negamax_Result negamax(const State_t &state, int depth, int alpha, int beta, int &node_count);
+  Negamax_Result negamax(Position &position, int depth, int alpha, int beta, int &node_count);
+
+  /**
+   * Write what the transposition table and the eval cache did during the
+   * search to stderr, as a line of text and as a JSON object. Nothing is
+   * written if NO_TTABLE_STATS is defined.
+   *
+   * @param move_string The move the search chose.
+   * @param value
+   * @param depth
+   */
+  void report_table_stats(const std::string &move_string, int value, int depth);
+
+  /**
+   * Take the next child to search. Unless fetch_next already started
+   * fetching its bucket, start now, just before the move is made.
+   *
+   * @param children
+   * @param position The node the children are moves from.
+   * @param fetched Whether fetch_next returned true for this child.
+   * @param child Set to the next move.
+   * @param child_hash The hash fetch_next set if fetched, otherwise set to the
+   *                   hash of the state the move leads to. Pass it to do_move.
+   * @return False once there are no children left.
+   */
+  bool pick_child(Move_Picker &children, const Position &position, bool fetched, Move &child,
+                  unsigned long long &child_hash);
+
+  /**
+   * Start fetching the bucket of the child after the one about to be
+   * searched, so the fetch overlaps that whole subtree. This is only done
+   * when the picker already holds the child in its current stage. Fetching
+   * further ahead would mean generating the next stage, which a node that
+   * cuts off never needs.
+   *
+   * @param children
+   * @param position The node the children are moves from.
+   * @param next_hash Set to the hash of the state the next child leads to.
+   * @return True if the bucket is being fetched.
+   */
+  bool fetch_next(Move_Picker &children, const Position &position, unsigned long long &next_hash);
+
+  /**
+   * The values in the table depend on the phase of the game through eval,
+   * which the hash of a state doesn't cover, so the phase key is mixed in
+   * as it is for the eval cache.
+   *
+   * @param hash The Zobrist hash of the state.
+   * @param move_number The MOVE NUMBER of the state.
+   * @return The key of the state in the table.
+   */
+  unsigned long long table_key(unsigned long long hash, unsigned int move_number) const;
+
+  bool prefetch{true};
 
   /**
    * This player's transposition table.
@@ -4,11 +4,12 @@
 
 #include <iostream>
 #include <random>
-#include <cassert>
 #include "AB_Player.h"
+#include "Move_Picker.h"
 
 std::string AB_Player::get_move_string(const std::string &state_string) {
-  State_t root_state = parse_input(state_string);
+  Board root_state = parse_input(state_string);
+  Position root_position(root_state, zobrist_table);
   my_player_color = root_state[PLAYER_ON_MOVE];
   Move current_move;
 
@@ -17,13 +18,13 @@ std::string AB_Player::get_move_string(const std::string &state_string) {
   int alpha = std::numeric_limits<int>::min();
   int beta = std::numeric_limits<int>::max();
 
-  Negamax_Result root_result = negamax(root_state, depth, alpha, beta, num_nodes);
+  Negamax_Result root_result = negamax(root_position, depth, alpha, beta, num_nodes);
 
-  std::cerr << "Returning move_string " << root_result.get_move_string()
+  std::cerr << "Returning move_string " << to_move_string(root_state, root_result.get_move())
             << " with value " << root_result.get_value()
             << ". Nodes evaluated: " << num_nodes << std::endl;
 
-  return root_result.get_move_string();
+  return to_move_string(root_state, root_result.get_move());
 }
 
 /**
@@ -31,17 +32,18 @@ std::string AB_Player::get_move_string(const std::string &state_string) {
  *      result <- negamax_result()
  *      if depth == 0 or state is terminal
  *          result.value <- eval(state)
- *          result.move_string <- ""
+ *          result.move <- null move
  *
  *      best_value = -inf
  *      child_states <- generate child states(state)
  *      foreach child in child_states
- *          child_state = make_move(state, child)
- *          child_result <- -negamax(child_state, depth-1, -beta, -alpha)
+ *          do_move(state, child)
+ *          child_result <- -negamax(state, depth-1, -beta, -alpha)
+ *          undo_move(state, child)
  *          if child_result.value > best_value
  *              best_value <- child_result.value
  *              result.value <- best_value
- *              result.move_string <- child.move_string ***IMPORTANT***
+ *              result.move <- child ***IMPORTANT***
  *          if alpha >= beta
  *              break
  *      return result
@@ -52,27 +54,29 @@ std::string AB_Player::get_move_string(const std::string &state_string) {
  * @param root
  * @return
  */
-Negamax_Result AB_Player::negamax(const State_t &state, int depth, int alpha, int beta, int &node_count) {
+Negamax_Result AB_Player::negamax(Position &position, int depth, int alpha, int beta, int &node_count) {
+  const Board &state = position.get_board();
   ++node_count;
   if (depth == 0 || is_terminal(state)) {
-    return Negamax_Result(eval(state), "");
+    return Negamax_Result(eval(position));
   }
 
   Negamax_Result result;
 
-  // children <- legal moves from state
-  std::vector<Move> children = generate_all_moves(state);
+  // children <- legal moves from state, handed out best first
+  Move_Picker children(position, Move());
 
   // extract some move child from children
-  Move child = children.front();
-  children.erase(children.begin());
-
-  // Make the move
-  State_t child_state = make_move(state, child);
+  Move child;
+  if (!children.next(child)) {
+    return Negamax_Result(eval(position));
+  }
 
-  // Get the negamax value of that move
-  result = -negamax(child_state, depth - 1, -beta, -alpha, node_count);
-  result.set_move_string(child.get_move_string());
+  // Make the move and get the negamax value of that move
+  position.do_move(child);
+  result = -negamax(position, depth - 1, -beta, -alpha, node_count);
+  position.undo_move();
+  result.set_move(child);
 
   int best_value = result.get_value();
 
@@ -84,10 +88,11 @@ Negamax_Result AB_Player::negamax(const State_t &state, int depth, int alpha, in
   // a <- max(a, child result value)
   alpha = std::max(alpha, result.get_value());
 
-  for (Move child : children) {
-    child_state = make_move(state, child);
-    Negamax_Result child_result = -negamax(child_state, depth - 1, -beta, -alpha, node_count);
-    child_result.set_move_string(child.get_move_string());
+  while (children.next(child)) {
+    position.do_move(child);
+    Negamax_Result child_result = -negamax(position, depth - 1, -beta, -alpha, node_count);
+    position.undo_move();
+    child_result.set_move(child);
 
     if (child_result.get_value() >= beta) {
       result = child_result;
@@ -27,14 +27,14 @@ public:
   /**
    * The negamax function with alpha beta pruning.
    *
-   * @param state
+   * @param position
    * @param depth
    * @param alpha
    * @param beta
    * @param node_count
    * @return
    */
-  Negamax_Result negamax(const State_t &state, int depth, int alpha, int beta, int &node_count);
+  Negamax_Result negamax(Position &position, int depth, int alpha, int beta, int &node_count);
 };
 
 
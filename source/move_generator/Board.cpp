@@ -0,0 +1,27 @@
+#include <sstream>
+#include "Board.h"
+#include "bitboard_tables.h"
+
+Board parse_input(const std::string &input) {
+  Board result;
+  std::istringstream iss(input);
+  for (unsigned int &word : result) {
+    if (!(iss >> word)) {
+      break;
+    }
+  }
+  return result;
+}
+
+bool is_terminal(const Board &state) {
+  return (state[MOVE_NUMBER] == 41)
+         || (state[BLACK_KING] == 0)
+         || (state[WHITE_KING] == 0);
+}
+
+std::string to_move_string(const Board &state, const Move &move) {
+  if (move.is_null()) {
+    return "";
+  }
+  return MOVE_STRINGS[to_square(state[move.get_mover_idx()])][move.get_end_square()].data();
+}
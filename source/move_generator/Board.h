@@ -0,0 +1,83 @@
+#ifndef MOVE_GENERATOR_BOARD_H
+#define MOVE_GENERATOR_BOARD_H
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include "Move.h"
+
+#define BOARD_WORDS 25
+
+/**
+ * The game state. The words are laid out exactly like the list of integers
+ * sent by the front end:
+ *
+ * 0    : BLACK KING POSITION
+ * 1    : BLACK QUEEN POSITION
+ * 2    : BLACK BISHOP POSITION
+ * 3    : BLACK KNIGHT POSITION
+ * 4    : BLACK ROOK POSITION
+ * 5-9  : BLACK PAWN POSITIONS
+ * 10-14: WHITE PAWN POSITIONS
+ * 15   : WHITE ROOK POSITION
+ * 16   : WHITE KNIGHT POSITION
+ * 17   : WHITE BISHOP POSITION
+ * 18   : WHITE QUEEN POSITION
+ * 19   : WHITE KING POSITION
+ * 20   : MOVE NUMBER
+ * 21   : PLAYER ON MOVE {1 WHITE, 2 BLACK}
+ * 22   : LOCATION OF ALL OPPONENTS
+ * 23   : LOCATION OF ALL EMPTY
+ * 24   : TIME LEFT IN MILLISECONDS
+ *
+ * The words live in a fixed size array, so a Board is trivially copyable and
+ * copying one never touches the heap. The search changes a single Position
+ * in place rather than copying Boards, so their layout isn't tuned further.
+ */
+struct Board {
+  std::array<unsigned int, BOARD_WORDS> words{};
+
+  unsigned int &operator[](std::size_t i) { return words[i]; }
+
+  const unsigned int &operator[](std::size_t i) const { return words[i]; }
+
+  unsigned int *begin() { return words.data(); }
+
+  unsigned int *end() { return words.data() + BOARD_WORDS; }
+
+  const unsigned int *begin() const { return words.data(); }
+
+  const unsigned int *end() const { return words.data() + BOARD_WORDS; }
+};
+
+/*
+ * The rules and the front end's formats, which every player and tool needs,
+ * so they are free functions rather than part of any one of them.
+ */
+
+/**
+ * Read the space-separated list of integers from the front end straight into
+ * the words of a Board.
+ *
+ * @param input - A space-separated list of integers as a std::string
+ * @return The game state.
+ */
+Board parse_input(const std::string &input);
+
+/**
+ * @param state
+ * @return True if the game is over: a king has been captured or move 41 has been reached.
+ */
+bool is_terminal(const Board &state);
+
+/**
+ * Look up the string the server expects for a move. This is only done at the
+ * root, once the search is finished.
+ *
+ * @param state The state the move was generated from.
+ * @param move
+ * @return The move as "a1-b2", or an empty string for the null move.
+ */
+std::string to_move_string(const Board &state, const Move &move);
+
+#endif //MOVE_GENERATOR_BOARD_H
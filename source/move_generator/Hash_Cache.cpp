@@ -0,0 +1,25 @@
+#include <algorithm>
+#include "Hash_Cache.h"
+
+Hash_Cache::Hash_Cache(std::size_t entries) {
+  std::size_t size = std::max<std::size_t>(1, entries);
+  // Round down to a power of two so the key can be masked into an index
+  while (size & (size - 1)) {
+    size &= size - 1;
+  }
+  this->entries.resize(size);
+  mask = size - 1;
+}
+
+void Hash_Cache::clear_stats() {
+  probes = 0ull;
+  hits = 0ull;
+}
+
+unsigned long long Hash_Cache::get_probes() const {
+  return probes;
+}
+
+unsigned long long Hash_Cache::get_hits() const {
+  return hits;
+}
@@ -0,0 +1,68 @@
+#ifndef MOVE_GENERATOR_HASH_CACHE_H
+#define MOVE_GENERATOR_HASH_CACHE_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * A value and the key it was stored under. An empty entry has key 0 and
+ * value 0.
+ */
+struct Hash_Cache_Entry {
+  unsigned long long key{0ull};
+  int value{0};
+};
+
+/**
+ * A small cache of values keyed by a Zobrist hash, for values that are
+ * cheaper to look up than to work out again: the pawn structure value by the
+ * hash of the pawns and eval by the hash of the position.
+ *
+ * It is lossy. Every key has one entry, and a new value simply overwrites
+ * whatever was there. It counts probes and hits, so its hit rate can be
+ * reported.
+ */
+class Hash_Cache {
+public:
+  /**
+   * @param entries The number of entries. It is rounded down to a power of two.
+   */
+  explicit Hash_Cache(std::size_t entries);
+
+  /**
+   * @param key
+   * @param value Set to the cached value on a hit.
+   * @return True if a value is cached under the key.
+   */
+  bool probe(unsigned long long key, int &value) {
+    const Hash_Cache_Entry &entry = entries[key & mask];
+    ++probes;
+    if (entry.key != key) {
+      return false;
+    }
+    ++hits;
+    value = entry.value;
+    return true;
+  }
+
+  void store(unsigned long long key, int value) {
+    entries[key & mask] = {key, value};
+  }
+
+  /**
+   * Zero the counters, e.g. at the start of a search.
+   */
+  void clear_stats();
+
+  unsigned long long get_probes() const;
+
+  unsigned long long get_hits() const;
+
+private:
+  std::vector<Hash_Cache_Entry> entries;
+  unsigned long long mask{0ull};
+  unsigned long long probes{0ull};
+  unsigned long long hits{0ull};
+};
+
+#endif //MOVE_GENERATOR_HASH_CACHE_H
@@ -6,22 +6,19 @@
 #include "Move.h"
 
 Move &Move::operator=(const Move &other) {
-  move_string = other.move_string;
-  mover_idx = other.mover_idx;
-  target_idx = other.target_idx;
-  end_pos = other.end_pos;
+  data = other.data;
   value = other.value;
-  attack = other.attack;
   return *this;
 }
 
 Move Move::operator-() const {
-  return Move(move_string, mover_idx, target_idx, end_pos, -value, attack);
+  Move result = *this;
+  result.value = -value;
+  return result;
 }
 
 bool Move::operator==(const Move &rhs) const {
-  return std::tie(move_string, mover_idx, target_idx, end_pos, value, attack) ==
-         std::tie(rhs.move_string, rhs.mover_idx, rhs.target_idx, rhs.end_pos, rhs.value, rhs.attack);
+  return std::tie(data, value) == std::tie(rhs.data, rhs.value);
 }
 
 bool Move::operator!=(const Move &rhs) const {
@@ -44,20 +41,20 @@ bool Move::operator>=(const Move &rhs) const {
   return !(*this < rhs);
 }
 
-const std::string &Move::get_move_string() const {
-  return move_string;
-}
-
 int Move::get_mover_idx() const {
-  return mover_idx;
+  return (data >> MOVER_SHIFT) & SQUARE_MASK;
 }
 
 int Move::get_target_idx() const {
-  return target_idx;
+  return is_attack() ? (data >> TARGET_SHIFT) & SQUARE_MASK : -1;
+}
+
+int Move::get_end_square() const {
+  return data & SQUARE_MASK;
 }
 
 unsigned int Move::get_end_pos() const {
-  return end_pos;
+  return 1u << get_end_square();
 }
 
 int Move::get_value() const {
@@ -65,5 +62,17 @@ int Move::get_value() const {
 }
 
 bool Move::is_attack() const {
-  return attack;
+  return ((data >> TARGET_SHIFT) & SQUARE_MASK) != NO_TARGET;
+}
+
+bool Move::is_promotion() const {
+  return (data & PROMOTION) != 0;
+}
+
+bool Move::is_null() const {
+  return data == 0;
+}
+
+uint16_t Move::get_data() const {
+  return data;
 }
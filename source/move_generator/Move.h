@@ -6,40 +6,72 @@
 #define MOVE_GENERATOR_MOVE_H
 
 
-#include <string>
-#include <utility>
-
+#include <cstdint>
+
+/**
+ * A move packed into 16 bits:
+ *
+ * 0-4  : DESTINATION SQUARE
+ * 5-9  : INDEX OF THE MOVER IN THE BOARD
+ * 10-14: INDEX OF THE CAPTURED PIECE IN THE BOARD, 31 FOR A NON-ATTACK MOVE
+ * 15   : PROMOTION
+ *
+ * The starting square isn't stored, it is wherever the mover stands in the
+ * Board the move was generated from. The value is only used to order moves
+ * and is kept beside the encoding rather than in it. A default constructed
+ * Move is the null move, which no piece can make since it would capture
+ * itself.
+ */
 class Move {
 private:
-  std::string move_string{""};
-  int mover_idx{-1};
-  int target_idx{-1};
-  unsigned int end_pos{0};
+  uint16_t data{0};
   int value{0};
-  bool attack{false};
 
-public:
-  const std::string &get_move_string() const;
+  static constexpr int MOVER_SHIFT = 5;
+  static constexpr int TARGET_SHIFT = 10;
+  static constexpr uint16_t SQUARE_MASK = 0x1f;
+  static constexpr uint16_t NO_TARGET = 0x1f;
+  static constexpr uint16_t PROMOTION = 1u << 15;
 
+public:
   int get_mover_idx() const;
 
   int get_target_idx() const;
 
+  int get_end_square() const;
+
   unsigned int get_end_pos() const;
 
   int get_value() const;
 
   bool is_attack() const;
 
+  bool is_promotion() const;
+
+  bool is_null() const;
+
+  uint16_t get_data() const;
+
   Move() = default;
 
-  Move(std::string move_string, int mover_idx, int target_idx, unsigned int end_pos, int value, bool attack)
-      : move_string(std::move(move_string)),
-        mover_idx(mover_idx),
-        target_idx(target_idx),
-        end_pos(end_pos),
-        value(value),
-        attack(attack) {};
+  /**
+   * @param data A move packed by get_data.
+   */
+  explicit Move(uint16_t data) : data(data) {};
+
+  /**
+   * @param mover_idx The index of the moving piece in the Board.
+   * @param target_idx The index of the captured piece in the Board, -1 for a non-attack move.
+   * @param end_pos The one-hot destination.
+   * @param value The ordering value of the move.
+   * @param promotion True if the mover is a pawn that promotes on end_pos.
+   */
+  Move(int mover_idx, int target_idx, unsigned int end_pos, int value, bool promotion)
+      : data(static_cast<uint16_t>(__builtin_ctz(end_pos)
+                                   | (mover_idx << MOVER_SHIFT)
+                                   | ((target_idx < 0 ? NO_TARGET : target_idx) << TARGET_SHIFT)
+                                   | (promotion ? PROMOTION : 0))),
+        value(value) {};
 
   Move &operator=(const Move &other);
 
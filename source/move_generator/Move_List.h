@@ -0,0 +1,47 @@
+#ifndef MOVE_GENERATOR_MOVE_LIST_H
+#define MOVE_GENERATOR_MOVE_LIST_H
+
+#include <array>
+#include <cstddef>
+#include "Move.h"
+
+/**
+ * The most moves a side can have. The widest reach of each piece on the
+ * 5x6 board is king 8, queen 17, bishop 12, knight 8 and rook 9, and five
+ * pawns that have all promoted add 5 * 17, for 139 in total.
+ */
+#define MAX_MOVES 160
+
+/**
+ * A list of moves that lives on the stack. It never allocates, so a search
+ * node can generate into one for free.
+ */
+class Move_List {
+public:
+  void push_back(const Move &move) { moves[count++] = move; }
+
+  void clear() { count = 0; }
+
+  std::size_t size() const { return count; }
+
+  bool empty() const { return count == 0; }
+
+  Move &operator[](std::size_t i) { return moves[i]; }
+
+  const Move &operator[](std::size_t i) const { return moves[i]; }
+
+  Move *begin() { return moves.data(); }
+
+  Move *end() { return moves.data() + count; }
+
+  const Move *begin() const { return moves.data(); }
+
+  const Move *end() const { return moves.data() + count; }
+
+private:
+  std::array<Move, MAX_MOVES> moves;
+  std::size_t count{0};
+};
+
+
+#endif //MOVE_GENERATOR_MOVE_LIST_H
@@ -0,0 +1,160 @@
+#include "Move_Picker.h"
+#include "bitboard_tables.h"
+
+Move_Picker::Move_Picker(const Position &position, const Move &hash_move)
+    : position(position), hash_move(hash_move) {}
+
+bool Move_Picker::next(Move &move) {
+  switch (stage) {
+    case HASH_MOVE:
+      stage = GENERATE_CAPTURES;
+      if (is_pseudo_legal(hash_move)) {
+        move = hash_move;
+        return true;
+      }
+      // Fall through
+    case GENERATE_CAPTURES:
+      generate_captures();
+      stage = CAPTURES;
+      // Fall through
+    case CAPTURES:
+      if (pick_best(move)) {
+        return true;
+      }
+      stage = GENERATE_QUIETS;
+      // Fall through
+    case GENERATE_QUIETS:
+      generate_quiets();
+      stage = QUIETS;
+      // Fall through
+    case QUIETS:
+      if (pick_best(move)) {
+        return true;
+      }
+      stage = DONE;
+      // Fall through
+    case DONE:
+    default:
+      return false;
+  }
+}
+
+/**
+ * Captures are scored most valuable victim, least valuable attacker.
+ */
+void Move_Picker::generate_captures() {
+  const Board &state = position.get_board();
+  unsigned int occupied = position.get_occupied();
+  unsigned int opponents = position.get_occupancy(opponent[state[PLAYER_ON_MOVE]]);
+  int first_target = opponent_player_index[state[PLAYER_ON_MOVE]];
+
+  moves.clear();
+  current = 0;
+  for (int mover_index = my_player_index[state[PLAYER_ON_MOVE]], end = mover_index + 10;
+       mover_index < end; ++mover_index) {
+    if (!state[mover_index]) {
+      continue;
+    }
+    int attacker_type = piece_type(mover_index, state[mover_index]);
+    unsigned int attacks = piece_reach(attacker_type, true, to_square(state[mover_index]), occupied) & opponents;
+    for (; attacks; attacks &= attacks - 1) {
+      unsigned int end_pos = attacks & -attacks;
+      int target_index = first_target;
+      for (; end_pos != (BOARD_MASK & state[target_index]); ++target_index);
+      int score = CAPTURE_ORDER[piece_type(target_index, state[target_index])] * 8 - CAPTURE_ORDER[attacker_type];
+      moves.push_back(Move(mover_index, target_index, end_pos, score, promotes(mover_index, end_pos)));
+    }
+  }
+}
+
+/**
+ * Quiet moves are scored by how much they improve the mover's piece-square
+ * value in the current phase of the game.
+ */
+void Move_Picker::generate_quiets() {
+  const Board &state = position.get_board();
+  unsigned int occupied = position.get_occupied();
+  int phase = game_phase(state[MOVE_NUMBER]);
+
+  moves.clear();
+  current = 0;
+  for (int mover_index = my_player_index[state[PLAYER_ON_MOVE]], end = mover_index + 10;
+       mover_index < end; ++mover_index) {
+    if (!state[mover_index]) {
+      continue;
+    }
+    int from_value = piece_square_value(phase, mover_index, state[mover_index]);
+    unsigned int quiets = piece_reach(piece_type(mover_index, state[mover_index]), false,
+                                      to_square(state[mover_index]), occupied) & ~occupied & BOARD_MASK;
+    for (; quiets; quiets &= quiets - 1) {
+      unsigned int end_pos = quiets & -quiets;
+      bool promotion = promotes(mover_index, end_pos);
+      int to_value = piece_square_value(phase, mover_index, promotion ? end_pos | PROMOTED_PAWN : end_pos);
+      moves.push_back(Move(mover_index, -1, end_pos, to_value - from_value, promotion));
+    }
+  }
+}
+
+bool Move_Picker::peek(Move &move) {
+  if ((stage != CAPTURES && stage != QUIETS) || !select_best()) {
+    return false;
+  }
+  move = moves[current];
+  return true;
+}
+
+bool Move_Picker::select_best() {
+  if (selected) {
+    return true;
+  }
+  for (; current < moves.size(); ++current) {
+    std::size_t best = current;
+    for (std::size_t i = current + 1; i < moves.size(); ++i) {
+      if (moves[i].get_value() > moves[best].get_value()) {
+        best = i;
+      }
+    }
+    std::swap(moves[current], moves[best]);
+    if (moves[current].get_data() != hash_move.get_data()) {
+      selected = true;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool Move_Picker::pick_best(Move &move) {
+  if (!select_best()) {
+    return false;
+  }
+  move = moves[current++];
+  selected = false;
+  return true;
+}
+
+bool Move_Picker::is_pseudo_legal(const Move &move) const {
+  if (move.is_null()) {
+    return false;
+  }
+  const Board &state = position.get_board();
+  int mover_index = move.get_mover_idx();
+  int first_mover = my_player_index[state[PLAYER_ON_MOVE]];
+  if (mover_index < first_mover || first_mover + 10 <= mover_index || !state[mover_index]) {
+    return false;
+  }
+
+  unsigned int end_pos = move.get_end_pos();
+  unsigned int reach = piece_reach(piece_type(mover_index, state[mover_index]), move.is_attack(),
+                                   to_square(state[mover_index]), position.get_occupied());
+  if (!(reach & end_pos) || move.is_promotion() != promotes(mover_index, end_pos)) {
+    return false;
+  }
+
+  if (move.is_attack()) {
+    int target_index = move.get_target_idx();
+    int first_target = opponent_player_index[state[PLAYER_ON_MOVE]];
+    return first_target <= target_index && target_index < first_target + 10
+           && (state[target_index] & BOARD_MASK) == end_pos;
+  }
+  return !(position.get_occupied() & end_pos);
+}
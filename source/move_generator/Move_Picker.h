@@ -0,0 +1,98 @@
+#ifndef MOVE_GENERATOR_MOVE_PICKER_H
+#define MOVE_GENERATOR_MOVE_PICKER_H
+
+#include "Move.h"
+#include "Move_List.h"
+#include "Position.h"
+
+/**
+ * The stages a Move_Picker works through, in order.
+ */
+enum Pick_Stage {
+  HASH_MOVE,
+  GENERATE_CAPTURES,
+  CAPTURES,
+  GENERATE_QUIETS,
+  QUIETS,
+  DONE,
+};
+
+/**
+ * Hands out the moves of a position one at a time, generating them in
+ * stages so that a node that cuts off early never pays for the rest:
+ *
+ * 1. The hash move, if it is a legal move in this position.
+ * 2. Captures, most valuable victim first and least valuable attacker
+ *    first among those.
+ * 3. Quiet moves, best piece-square gain first.
+ *
+ * Moves are ordered with cheap table lookups, never by evaluating the
+ * child. The Position may be played on between calls to next, as long as
+ * it is back where it started when next is called.
+ */
+class Move_Picker {
+public:
+  /**
+   * @param position
+   * @param hash_move A move to try first, usually from the transposition
+   *                  table. The null move if there is none.
+   */
+  Move_Picker(const Position &position, const Move &hash_move);
+
+  /**
+   * @param move Set to the next move to search.
+   * @return False once every move has been handed out.
+   */
+  bool next(Move &move);
+
+  /**
+   * Look at the move next will hand out, if it is already in hand: a
+   * remaining move of the stage being handed out. It never generates the
+   * moves of the next stage, so a node that cuts off still doesn't pay for
+   * them.
+   *
+   * @param move Set to the move next will return.
+   * @return False if next would have to start a new stage.
+   */
+  bool peek(Move &move);
+
+private:
+  void generate_captures();
+
+  void generate_quiets();
+
+  /**
+   * Move the best remaining move to the current place, skipping the hash
+   * move which has already been searched.
+   *
+   * @return False if there are no moves left in this stage.
+   */
+  bool select_best();
+
+  /**
+   * Hand out the best remaining move.
+   *
+   * @param move
+   * @return False if there are no moves left in this stage.
+   */
+  bool pick_best(Move &move);
+
+  /**
+   * @param move
+   * @return True if move could have been generated from this position.
+   */
+  bool is_pseudo_legal(const Move &move) const;
+
+  const Position &position;
+  Move hash_move;
+  Pick_Stage stage{HASH_MOVE};
+  Move_List moves;
+  std::size_t current{0};
+  /**
+   * Whether the move at current has already been selected, by peek.
+   */
+  bool selected{false};
+};
+
+
+#endif //MOVE_GENERATOR_MOVE_PICKER_H
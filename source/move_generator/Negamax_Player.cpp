@@ -8,15 +8,16 @@
 #include "Move.h"
 
 std::string Negamax_Player::get_move_string(const std::string &state_string) {
-  State_t root_state = parse_input(state_string);
+  Board root_state = parse_input(state_string);
+  Position root_position(root_state, zobrist_table);
   Move current_move;
   int num_nodes = 0;
   int depth = 4;
-  Negamax_Result root_result = negamax(root_state, depth, num_nodes);
-  std::cerr << "Returning move_string " << root_result.get_move_string()
+  Negamax_Result root_result = negamax(root_position, depth, num_nodes);
+  std::cerr << "Returning move_string " << to_move_string(root_state, root_result.get_move())
             << " with value " << root_result.get_value()
             << ". Nodes evaluated: " << num_nodes << std::endl;
-  return root_result.get_move_string();
+  return to_move_string(root_state, root_result.get_move());
 }
 
 /**
@@ -24,17 +25,18 @@ std::string Negamax_Player::get_move_string(const std::string &state_string) {
  *      result <- negamax_result()
  *      if depth == 0 or state is terminal
  *          result.value <- eval(state)
- *          result.move_string <- ""
+ *          result.move <- null move
  *
  *      best_value = -inf
  *      child_states <- generate child states(state)
  *      foreach child in child_states
- *          child_state = make_move(state, child)
- *          child_result <- -negamax(child_state, depth-1)
+ *          do_move(state, child)
+ *          child_result <- -negamax(state, depth-1)
+ *          undo_move(state, child)
  *          if child_result.value > best_value
  *              best_value <- child_result.value
  *              result.value <- best_value
- *              result.move_string <- child.move_string ***IMPORTANT***
+ *              result.move <- child ***IMPORTANT***
  *      return result
  *
  * @param state
@@ -43,24 +45,27 @@ std::string Negamax_Player::get_move_string(const std::string &state_string) {
  * @param root
  * @return
  */
-Negamax_Result Negamax_Player::negamax(const State_t &state, int depth, int &node_count) {
+Negamax_Result Negamax_Player::negamax(Position &position, int depth, int &node_count) {
+  const Board &state = position.get_board();
   ++node_count;
   if (depth == 0 || is_terminal(state)) {
-    return Negamax_Result(eval(state), "");
+    return Negamax_Result(eval(position));
   }
 
   Negamax_Result result;
   int best_value = std::numeric_limits<int>::min();
 
-  std::vector<Move> children = generate_all_moves(state);
+  Move_List children;
+  generate_all_moves(position, children);
 
-  for (Move child : children) {
-    State_t child_state = make_move(state, child);
-    Negamax_Result child_result = -negamax(child_state, depth - 1, node_count);
+  for (const Move &child : children) {
+    position.do_move(child);
+    Negamax_Result child_result = -negamax(position, depth - 1, node_count);
+    position.undo_move();
     if (child_result.get_value() > best_value) {
       best_value = child_result.get_value();
       result.set_value(best_value);
-      result.set_move_string(child.get_move_string());
+      result.set_move(child);
     }
   }
   return result;
@@ -26,12 +26,12 @@ public:
   /**
    * The negamax function.
    *
-   * @param state
+   * @param position
    * @param depth
    * @param node_count
    * @return
    */
-  Negamax_Result negamax(const State_t &state, int depth, int &node_count);
+  Negamax_Result negamax(Position &position, int depth, int &node_count);
 };
 
 
@@ -2,7 +2,6 @@
 // Created by Michael Lane on 6/9/17.
 //
 
-#include <utility>
 #include "Negamax_Result.h"
 
 int Negamax_Result::get_value() const {
@@ -13,17 +12,17 @@ void Negamax_Result::set_value(int value) {
   Negamax_Result::value = value;
 }
 
-const std::string &Negamax_Result::get_move_string() const {
-  return move_string;
+const Move &Negamax_Result::get_move() const {
+  return move;
 }
 
-void Negamax_Result::set_move_string(const std::string &move_string) {
-  Negamax_Result::move_string = move_string;
+void Negamax_Result::set_move(const Move &move) {
+  Negamax_Result::move = move;
 }
 
 bool Negamax_Result::operator==(const Negamax_Result &rhs) const {
   return value == rhs.value &&
-         move_string == rhs.move_string;
+         move == rhs.move;
 }
 
 bool Negamax_Result::operator!=(const Negamax_Result &rhs) const {
@@ -31,13 +30,16 @@ bool Negamax_Result::operator!=(const Negamax_Result &rhs) const {
 }
 
 Negamax_Result Negamax_Result::operator-() {
-  return Negamax_Result(-value, move_string);
+  Negamax_Result result(-value, move);
+  result.timeout = timeout;
+  return result;
 }
 
 Negamax_Result &Negamax_Result::operator=(const Negamax_Result &other) {
   if (&other != this) {
     value = other.value;
-    move_string = other.move_string;
+    move = other.move;
+    timeout = other.timeout;
   }
   return *this;
 }
@@ -58,3 +60,10 @@ void Negamax_Result::setWin(bool win) {
   Negamax_Result::win = win;
 }
 
+bool Negamax_Result::isTimeout() const {
+  return timeout;
+}
+
+void Negamax_Result::setTimeout(bool timeout) {
+  Negamax_Result::timeout = timeout;
+}
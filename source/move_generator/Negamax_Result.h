@@ -5,9 +5,7 @@
 #ifndef MOVE_GENERATOR_NEGAMAX_RESULT_H
 #define MOVE_GENERATOR_NEGAMAX_RESULT_H
 
-#include <string>
-#include <utility>
-#include <random>
+#include "Move.h"
 
 /**
  * A class to help deal with the results of the negamax function. It is
@@ -17,7 +15,9 @@ class Negamax_Result {
 public:
   Negamax_Result() = default;
 
-  Negamax_Result(int value, std::string move_string) : value(value), move_string(std::move(move_string)) {}
+  explicit Negamax_Result(int value) : value(value) {}
+
+  Negamax_Result(int value, const Move &move) : value(value), move(move) {}
 
   Negamax_Result &operator=(const Negamax_Result &other);
 
@@ -25,9 +25,9 @@ public:
 
   void set_value(int value);
 
-  const std::string &get_move_string() const;
+  const Move &get_move() const;
 
-  void set_move_string(const std::string &move_string);
+  void set_move(const Move &move);
 
   bool operator==(const Negamax_Result &rhs) const;
 
@@ -43,11 +43,20 @@ public:
 
   void setWin(bool win);
 
+  /**
+   * A search that ran out of time returns a result with this set. The value
+   * and move of a timed out result are meaningless.
+   */
+  bool isTimeout() const;
+
+  void setTimeout(bool timeout);
+
 private:
   int value{0};
   bool loss{false};
   bool win{false};
-  std::string move_string;
+  bool timeout{false};
+  Move move;
 };
 
 
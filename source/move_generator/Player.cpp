@@ -5,13 +5,13 @@
 #include <sstream>
 #include <iostream>
 #include <algorithm>
-#include <iterator>
 #include <chrono>
+#include <limits>
 #include "Move.h"
 #include "Player.h"
 
 /**
- * State_t has the following values at each index:
+ * Board has the following values at each index:
  * 0    : BLACK KING POSITION
  * 1    : BLACK QUEEN POSITION
  * 2    : BLACK BISHOP POSITION
@@ -31,47 +31,26 @@
  * 24   : TIME LEFT IN MILLISECONDS
  */
 
-/**
- * I found this little snippet of goodness on Stack Overflow: http://stackoverflow.com/questions/236129/split-a-string-in-c
- *
- * @param input - A space-separated list of integers as a std::string
- * @return A vector of unsigned ints ... the game state!
- */
-State_t Player::parse_input(const std::string &input) {
-  std::istringstream iss(input);
-  return {
-      std::istream_iterator<unsigned int>{iss},
-      std::istream_iterator<unsigned int>{}
-  };
-}
-
 /**
  * Generate all of the possible move strings for a given state.
  * @param state
  * @return
  */
-std::vector<std::string> Player::generate_all_move_strings(const State_t &state) {
+std::vector<std::string> Player::generate_all_move_strings(const Board &state) {
   std::vector<std::string> result, attack_strings, move_strings;
   // Get the starting index for the player on Move
   int mover_index = my_player_index[state[PLAYER_ON_MOVE]];
   int end = mover_index + 10;
-  std::string start_pos = "";
-  std::string move_string = "";
 
   // Iterate over the pieces putting together Move strings from bitboards
   for (; mover_index < end; ++mover_index) {
     if (state[mover_index]) {
-      start_pos = TO_STR[state[mover_index]];
-      move_string = start_pos + "-";
-
-      int shadow_mask = generate_shadow_mask(state, mover_index);
-
       // Append attack strings
-      std::vector<std::string> attacks = generate_attack_strings(state, mover_index, shadow_mask, move_string);
+      std::vector<std::string> attacks = generate_attack_strings(state, mover_index);
       attack_strings.insert(attack_strings.end(), attacks.begin(), attacks.end());
 
       // Append Move strings
-      std::vector<std::string> moves = generate_move_strings(state, mover_index, shadow_mask, move_string);
+      std::vector<std::string> moves = generate_move_strings(state, mover_index);
       move_strings.insert(move_strings.end(), moves.begin(), moves.end());
     }
   }
@@ -80,41 +59,40 @@ std::vector<std::string> Player::generate_all_move_strings(const State_t &state)
   return result;
 }
 
-std::vector<Move> Player::generate_all_moves(const State_t &state) {
+/**
+ * Generate all of the moves for the side on move, attacks first, each group ordered by the
+ * value of the position it leads to. The moves are made and taken back on position to
+ * evaluate them, so position is unchanged on return.
+ * @param position
+ * @param moves Filled with the moves, in order.
+ */
+void Player::generate_all_moves(Position &position, Move_List &moves) {
+  const Board &state = position.get_board();
   if (state[BLACK_KING] == 0 || state[WHITE_KING] == 0) {
     std::cerr << "Trying to generate moves from a terminal state!" << std::endl;
   }
-  std::vector<Move> result, all_attacks, all_moves;
+  moves.clear();
   // Get the starting index for the player on Move
-  int mover_index = my_player_index[state[PLAYER_ON_MOVE]];
-  int end = mover_index + 10;
-  std::string start_pos_str = "";
-  std::string move_string = "";
+  int first = my_player_index[state[PLAYER_ON_MOVE]];
+  int end = first + 10;
 
-  // Iterate over the pieces putting together Move strings from bitboards
-  for (; mover_index < end; ++mover_index) {
+  // Iterate over the pieces appending attacks from bitboards, then the same for non-attack moves
+  for (int mover_index = first; mover_index < end; ++mover_index) {
     if (state[mover_index]) {
-      start_pos_str = TO_STR[state[mover_index]];
-      move_string = start_pos_str + "-";
-
-      int shadow_mask = generate_shadow_mask(state, mover_index);
-
-      // Append attack strings
-      std::vector<Move> attacks = generate_attacks(state, mover_index, shadow_mask, move_string);
-      all_attacks.insert(all_attacks.end(), attacks.begin(), attacks.end());
-
-      // Append Move strings
-      std::vector<Move> moves = generate_moves(state, mover_index, shadow_mask, move_string);
-      all_moves.insert(all_moves.end(), moves.begin(), moves.end());
+      generate_attacks(position, mover_index, moves);
     }
   }
-  std::shuffle(all_attacks.begin(), all_attacks.end(), mt);
-  std::sort(all_attacks.begin(), all_attacks.end());
-  std::shuffle(all_moves.begin(), all_moves.end(), mt);
-  std::sort(all_moves.begin(), all_moves.end());
-  result.insert(result.end(), all_attacks.begin(), all_attacks.end());
-  result.insert(result.end(), all_moves.begin(), all_moves.end());
-  if (result.size() < 1) {
+  Move *first_move = moves.end();
+  for (int mover_index = first; mover_index < end; ++mover_index) {
+    if (state[mover_index]) {
+      generate_moves(position, mover_index, moves);
+    }
+  }
+  std::shuffle(moves.begin(), first_move, mt);
+  std::sort(moves.begin(), first_move);
+  std::shuffle(first_move, moves.end(), mt);
+  std::sort(first_move, moves.end());
+  if (moves.empty()) {
     std::cerr << "Failed to generate any legal moves!" << std::endl;
     std::cerr << "State: " << std::endl;
     for (unsigned int val : state) {
@@ -122,29 +100,21 @@ std::vector<Move> Player::generate_all_moves(const State_t &state) {
     }
     std::cerr << std::endl;
   }
-  return result;
 }
 
 
 /**
- * Given a piece at a given location look at all the other pieces that could potentially be
- * in the way and create a shadow of 0's behind those pieces. Note, knights don't create shadows.
+ * Given a piece, find every square it can reach without passing through another piece.
+ * Sliders stop at the first piece on each ray, knights jump, and everything else only
+ * steps to adjacent squares. Captured pieces reach nothing.
  * @param state
  * @param mover_index
+ * @param attack True for attack targets, false for non-attack moves.
  * @return
  */
-int Player::generate_shadow_mask(const State_t &state, int mover_index) {
-  unsigned int shadow_mask = (1 << 30) - 1;
-
-  // Generate the shadow cast by any piece on a Move spoke
-  if (mover_index != 3 && mover_index != 16) {  // Knights can jump over other players
-    for (int j = 0; j < 20; ++j) {
-      if (j != mover_index && state[j] && SHADOW_MASK[state[mover_index]].count(state[j])) {
-        shadow_mask &= ~SHADOW_MASK[state[mover_index]][state[j]];
-      }
-    }
-  }
-  return shadow_mask;
+unsigned int Player::generate_reach(const Board &state, int mover_index, bool attack) {
+  unsigned int occupancy = ~state[LOCATION_OF_EMPTY] & BOARD_MASK;
+  return piece_reach(piece_type(mover_index, state[mover_index]), attack, to_square(state[mover_index]), occupancy);
 }
 
 /**
@@ -155,22 +125,15 @@ int Player::generate_shadow_mask(const State_t &state, int mover_index) {
  *
  * @param state
  * @param mover_index
- * @param shadow_mask
- * @param move_string
  * @return
  */
 std::vector<std::string>
-Player::generate_attack_strings(const State_t &state, int mover_index, int shadow_mask,
-                                const std::string &move_string) {
+Player::generate_attack_strings(const Board &state, int mover_index) {
   std::vector<std::string> result;
-  // Iterate over possible destination locations for a given piece type at a given location
-  // to determine if there are available attacks.
-  for (unsigned int pos : type_to_attack[mover_index][state[mover_index]]) {
-    if (pos & state[LOCATION_OF_OPPONENTS] & shadow_mask) {
-      int target_index = 0;
-      for (; target_index < 20 && pos != state[target_index]; ++target_index);
-      result.push_back(move_string + TO_STR[pos]);
-    }
+  // Iterate over the unblocked opponent locations a given piece type at a given location can reach.
+  unsigned int attacks = generate_reach(state, mover_index, true) & state[LOCATION_OF_OPPONENTS];
+  for (; attacks; attacks &= attacks - 1) {
+    result.push_back(MOVE_STRINGS[to_square(state[mover_index])][__builtin_ctz(attacks)].data());
   }
   return result;
 }
@@ -183,245 +146,119 @@ Player::generate_attack_strings(const State_t &state, int mover_index, int shado
  *
  * @param state
  * @param mover_index
- * @param shadow_mask
- * @param move_string
  * @return
  */
 std::vector<std::string>
-Player::generate_move_strings(const State_t &state, int mover_index, int shadow_mask, const std::string &move_string) {
+Player::generate_move_strings(const Board &state, int mover_index) {
   std::vector<std::string> result;
-  // Iterate over possible empty destination cells for a given type at a given location.
-  for (unsigned int pos : type_to_move[mover_index][state[mover_index]]) {
-    if (pos & state[LOCATION_OF_EMPTY] & shadow_mask) {
-      result.push_back(move_string + TO_STR[pos]);
-    }
+  // Iterate over the unblocked empty cells a given piece type at a given location can reach.
+  unsigned int moves = generate_reach(state, mover_index, false) & state[LOCATION_OF_EMPTY];
+  for (; moves; moves &= moves - 1) {
+    result.push_back(MOVE_STRINGS[to_square(state[mover_index])][__builtin_ctz(moves)].data());
   }
   return result;
 }
 
-std::vector<Move>
-Player::generate_attacks(const State_t &state, int mover_index, int shadow_mask, const std::string &move_string) {
-  std::vector<Move> result;
-
-  for (unsigned int end_pos : type_to_attack[mover_index][state[mover_index]]) {
-    if (end_pos & state[LOCATION_OF_OPPONENTS] & shadow_mask) {
-      int target_index = 0;
-      for (; target_index < 20 && end_pos != (((1 << 30) -1) & state[target_index]); ++target_index);
-      if (target_index > 19) {
-        //pass
-      }
-      State_t new_state = make_attack(state, mover_index, target_index);
-      int attack_effectiveness_penalty = 0;
-      if (new_state[PLAYER_ON_MOVE] == 1) {
-        attack_effectiveness_penalty = white_on_move_values[target_index] + white_on_move_values[mover_index];
-      } else {
-        attack_effectiveness_penalty = black_on_move_values[target_index] + black_on_move_values[mover_index];
-      }
-      result.push_back(
-          Move(
-              move_string + TO_STR[end_pos],                   // move_string
-              mover_index,                                     // mover_idx
-              target_index,                                    // target_idx
-              end_pos,                                         // end_pos
-              eval(new_state) - attack_effectiveness_penalty,  // value
-              true                                             // attack
-          ));
+void Player::generate_attacks(Position &position, int mover_index, Move_List &result) {
+  const Board &state = position.get_board();
+
+  unsigned int attacks = piece_reach(piece_type(mover_index, state[mover_index]), true,
+                                     to_square(state[mover_index]), position.get_occupied())
+                         & position.get_occupancy(opponent[state[PLAYER_ON_MOVE]]);
+  for (; attacks; attacks &= attacks - 1) {
+    unsigned int end_pos = attacks & -attacks;
+    int target_index = 0;
+    for (; target_index < 20 && end_pos != (BOARD_MASK & state[target_index]); ++target_index);
+    Move attack(mover_index, target_index, end_pos, 0, promotes(mover_index, end_pos));
+    position.do_move(attack);
+    int attack_effectiveness_penalty = 0;
+    if (state[PLAYER_ON_MOVE] == 1) {
+      attack_effectiveness_penalty = white_on_move_values[target_index] + white_on_move_values[mover_index];
+    } else {
+      attack_effectiveness_penalty = black_on_move_values[target_index] + black_on_move_values[mover_index];
     }
+    int value = eval(position) - attack_effectiveness_penalty;
+    position.undo_move();
+    result.push_back(
+        Move(
+            mover_index,                                     // mover_idx
+            target_index,                                    // target_idx
+            end_pos,                                         // end_pos
+            value,                                           // value
+            attack.is_promotion()                            // promotion
+        ));
   }
-  return result;
 }
 
-std::vector<Move>
-Player::generate_moves(const State_t &state, int mover_index, int shadow_mask, const std::string &move_string) {
-  std::vector<Move> result;
-
-  for (unsigned int end_pos : type_to_move[mover_index][state[mover_index]]) {
-    if (end_pos & state[LOCATION_OF_EMPTY] & shadow_mask) {
-      State_t new_state = make_move(state, mover_index, end_pos);
-      result.push_back(
-          Move(
-              move_string + TO_STR[end_pos],  // move_string
-              mover_index,                    // mover_idx
-              -1,                             // target_idx
-              end_pos,                        // end_pos
-              eval(new_state),                // value
-              false                           // attack
-          ));
-    }
+void Player::generate_moves(Position &position, int mover_index, Move_List &result) {
+  const Board &state = position.get_board();
+
+  unsigned int occupied = position.get_occupied();
+  unsigned int moves = piece_reach(piece_type(mover_index, state[mover_index]), false,
+                                   to_square(state[mover_index]), occupied)
+                       & ~occupied & BOARD_MASK;
+  for (; moves; moves &= moves - 1) {
+    unsigned int end_pos = moves & -moves;
+    Move move(mover_index, -1, end_pos, 0, promotes(mover_index, end_pos));
+    position.do_move(move);
+    int value = eval(position);
+    position.undo_move();
+    result.push_back(
+        Move(
+            mover_index,                                     // mover_idx
+            -1,                                              // target_idx
+            end_pos,                                         // end_pos
+            value,                                           // value
+            move.is_promotion()                              // promotion
+        ));
   }
-  return result;
 }
 
-State_t Player::make_attack(const State_t &state, int attacker_index, int target_index) {
-  State_t result = state;
-  // xor attacker with itself, zeros it
-  result[attacker_index] ^= result[attacker_index];
-  // xor attacker with target moves the attacker (mask off promoted pawn)
-  result[attacker_index] ^= (result[target_index] & ((1 << 30) - 1));
-  // xor target with itself zeros it
-  result[target_index] ^= result[target_index];
-
-  if((((0 <= attacker_index) && (attacker_index < 5))
-      || ((15 <= attacker_index) && (attacker_index < 20)))
-      && (result[attacker_index] >= (1 << 30))) {
-    std::cerr << std::endl << "-------------------------------------------------------------" << std::endl;
-    std::cerr << "make attack error!" << std::endl;
-    std::cerr << "state[" << attacker_index << "]: " << state[attacker_index] << std::endl;
-    std::cerr << " state[" << target_index << "]: " << state[target_index] << std::endl;
-    std::cerr << "result[" << attacker_index << "]: " << result[attacker_index] << std::endl;
-    std::cerr << " result[" << target_index << "]: " << result[target_index] << std::endl;
-
-    std::cerr << "Incoming state: ";
-    for (unsigned int v : state) {
-      std::cerr << v << " ";
-    }
-    std::cerr << "Resulting state: ";
-    for (unsigned int v : result) {
-      std::cerr << v << " ";
+/**
+ * @param my_pawns
+ * @param opponent_pawns
+ * @param color The PLAYER ON MOVE value of the side that owns my_pawns {1 WHITE, 2 BLACK}.
+ * @return The pawn structure value of one side, see DOUBLED_PAWN_VALUE.
+ */
+static int side_pawn_structure_value(unsigned int my_pawns, unsigned int opponent_pawns, unsigned int color) {
+  int result = 0;
+  for (int file = 0; file < BOARD_WIDTH; ++file) {
+    if (__builtin_popcount(FILE_MASKS[file] & my_pawns) > 1) {
+      result -= DOUBLED_PAWN_VALUE;
     }
-    std::cerr << std::endl;
-  }
-
-  // Bookkeeping. Update the player on Move. Update the opponents location. Update the empty cells
-  result[PLAYER_ON_MOVE] = opponent[result[PLAYER_ON_MOVE]];
-  result[LOCATION_OF_OPPONENTS] ^= result[LOCATION_OF_OPPONENTS];  // zero opponents locations
-  for (int opponent_index = opponent_player_index[result[PLAYER_ON_MOVE]], end = opponent_index + 10;
-       opponent_index < end; ++opponent_index) {
-    result[LOCATION_OF_OPPONENTS] |= result[opponent_index];
-  }
-
-  // Update the location of the empty cells (negation of all cells with pieces)
-  result[LOCATION_OF_EMPTY] ^= result[LOCATION_OF_EMPTY];
-  for (int i = 0; i < 20; ++i) {
-    result[LOCATION_OF_EMPTY] |= result[i];
-  }
-
-  // Since we're dealing with 32 bit ints, don't forget to mask off the top 2 bits
-  result[LOCATION_OF_EMPTY] = ~result[LOCATION_OF_EMPTY] & ((1 << 30) - 1);
-
-  // If this is a pawn and it's at either the top or bottom, make it a promoted pawn
-  if ((4 < attacker_index && attacker_index < 15)
-      && ((result[attacker_index] > (1 << 19) || ((1 << 5) > result[attacker_index])))) {
-    result[attacker_index] |= (1 << 30);  // promoted pawn
-  }
-
-  // Update the Move number
-  ++result[MOVE_NUMBER];
-  return result;
-}
-
-State_t Player::make_move(const State_t &state, int mover_index, int dest_pos) {
-  State_t result = state;
-  // xor state[mover_index] with itself to clear it.
-  result[mover_index] ^= result[mover_index];
-  // xor state[mover_index] with destination position to make the Move
-  result[mover_index] ^= dest_pos;
-
-  // Bookkeeping, same as make_attack
-  result[PLAYER_ON_MOVE] = opponent[state[PLAYER_ON_MOVE]];
-  result[LOCATION_OF_OPPONENTS] ^= result[LOCATION_OF_OPPONENTS];  // zero opponents locations
-
-  for (int opponent_index = opponent_player_index[result[PLAYER_ON_MOVE]], end = opponent_index + 10;
-       opponent_index < end; ++opponent_index) {
-    result[LOCATION_OF_OPPONENTS] |= result[opponent_index];
-  }
-
-  // Update the location of the empty cells (negation of all cells with pieces)
-  result[LOCATION_OF_EMPTY] ^= result[LOCATION_OF_EMPTY];
-  for (int i = 0; i < 20; ++i) {
-    result[LOCATION_OF_EMPTY] |= result[i];
   }
-
-  // Since we're dealing with 32 bit ints, don't forget to mask off the top 2 bits
-  result[LOCATION_OF_EMPTY] = ~result[LOCATION_OF_EMPTY] & ((1 << 30) - 1);
-
-  // If this is a pawn and it's at either the top or bottom, make it a promoted pawn
-  if ((4 < mover_index && mover_index < 15)
-      && ((result[mover_index] > (1 << 19) || ((1 << 5) > result[mover_index])))) {
-    result[mover_index] |= (1 << 30);  // promoted pawn
-  }
-
-  // Update Move number
-  ++result[MOVE_NUMBER];
-
-  return result;
-}
-
-State_t Player::make_move(const State_t &state, const Move &move) {
-  if (move.is_attack()) {
-    return make_attack(state, move.get_mover_idx(), move.get_target_idx());
-  }
-  return make_move(state, move.get_mover_idx(), move.get_end_pos());
-}
-
-int Player::calculate_material_value(const State_t &state) {
-  int result = 0;
-
-  for (int i = 0, q_idx = 1; i < 20; ++i) {
-    if (i == 10) { q_idx = 18; }
-    if (state[i] == 0) {
-      // pass
-    } else if (state[i] > 0 && state[i] < (1 << 30)) {
-      if (state[PLAYER_ON_MOVE] == 1) {
-        result += white_on_move_values[i];
-      } else {
-        result += black_on_move_values[i];
-      }
-    } else {
-      if (state[PLAYER_ON_MOVE] == 1) {
-        result += white_on_move_values[q_idx];
-      } else {
-        result += black_on_move_values[q_idx];
-      }
+  for (unsigned int pawns = my_pawns; pawns; pawns &= pawns - 1) {
+    int square = __builtin_ctz(pawns);
+    if (!(ADJACENT_FILE_MASKS[square_file(square)] & my_pawns)) {
+      result -= ISOLATED_PAWN_VALUE;
+    }
+    if (!(PASSED_PAWN_MASKS[color == 1][square] & opponent_pawns)) {
+      int rank = square_rank(square);
+      result += PASSED_PAWN_VALUES[(color == 1) ? rank : BOARD_HEIGHT - 1 - rank];
     }
   }
-
   return result;
 }
 
-int Player::calculate_heuristic_value(const State_t &state) {
-  int result = 0;
-  // Add in the heuristic value of my players' positions
-  for (int i = my_player_index[state[PLAYER_ON_MOVE]], end = i + 10; i < end; ++i) {
-    if (state[MOVE_NUMBER] <= 10) {
-      result += begin_heuristic_dispatch[i][state[i]];
-    } else if (state[MOVE_NUMBER] <= 25) {
-      result += middle_heuristic_dispatch[i][state[i]];
-    } else {
-      result += end_heuristic_dispatch[i][state[i]];
-    }
-  }
-
-  // Deduct the heuristic value of the opposing players' positions
-  for (int i = opponent_player_index[state[PLAYER_ON_MOVE]], end = i + 10; i < end; ++i) {
-    if (state[MOVE_NUMBER] <= 10) {
-      result -= begin_heuristic_dispatch[i][state[i]];
-    } else if (state[MOVE_NUMBER] <= 25) {
-      result -= middle_heuristic_dispatch[i][state[i]];
-    } else {
-      result -= end_heuristic_dispatch[i][state[i]];
+int Player::calculate_pawn_structure_value(const Position &position) {
+  unsigned long long pawn_hash = position.get_pawn_hash();
+  int value;
+  // An empty entry is a hit for a board without pawns, whose value is 0 anyway
+  if (!pawn_table.probe(pawn_hash, value)) {
+    unsigned int black_pawns = 0;
+    unsigned int white_pawns = 0;
+    for (int i = 5; i < 10; ++i) {
+      black_pawns |= (position[i] & PROMOTED_PAWN) ? 0 : position[i];
+      white_pawns |= (position[i + 5] & PROMOTED_PAWN) ? 0 : position[i + 5];
     }
+    value = side_pawn_structure_value(white_pawns, black_pawns, 1)
+            - side_pawn_structure_value(black_pawns, white_pawns, 2);
+    pawn_table.store(pawn_hash, value);
   }
-
-  unsigned int black_pawns = state[5] | state[6] | state[7] | state[8] | state[9];
-  unsigned int white_pawns = state[10] | state[11] | state[12] | state[13] | state[14];
-
-  unsigned int my_pawns = (state[PLAYER_ON_MOVE] == 1) ? white_pawns : black_pawns;
-  unsigned int opponent_pawns = (state[PLAYER_ON_MOVE] == 1) ? black_pawns : white_pawns;
-
-  // Deduct heuristic value of my pawns on the same file
-  for (int i=0, mask=0x21084210; i < 5; ++i, mask >>= 1) {
-    result = (__builtin_popcount(mask & my_pawns) > 1) ? result - 20 : result;
-  }
-
-  // Add in heuristic value of opponent's pawns on the same file
-  for (int i=0, mask=0x21084210; i < 5; ++i, mask >>= 1) {
-    result = (__builtin_popcount(mask & my_pawns) > 1) ? result + 20 : result;
-  }
-  return result;
+  return (position[PLAYER_ON_MOVE] == 1) ? value : -value;
 }
 
-int Player::calculate_number_of_attacks(const State_t &state, int idx, bool opponent) {
+int Player::calculate_number_of_attacks(const Board &state, int idx, bool opponent) {
   int result = 0;
   unsigned int locs;
   if (opponent) {
@@ -430,36 +267,40 @@ int Player::calculate_number_of_attacks(const State_t &state, int idx, bool oppo
     locs = ~(state[LOCATION_OF_OPPONENTS] | state[LOCATION_OF_EMPTY]);
   }
   for (int i = idx, end = i + 10; i < end; ++i) {
-    int attacks = 0;
-    unsigned int combined_attacks = combined_attack_dispatch[i][state[i]];
-    combined_attacks &= ~(state[i]);
-    int shadows = generate_shadow_mask(state, i);
-    attacks |= (locs & combined_attacks & shadows);
-    result += __builtin_popcount(attacks);
+    result += __builtin_popcount(locs & generate_reach(state, i, true));
   }
   return result;
 }
 
-int Player::calculate_number_of_moves(const State_t &state, int idx) {
+int Player::calculate_number_of_moves(const Board &state, int idx) {
   int result = 0;
   for (int i = idx, end = i + 10; i < end; ++i) {
-    int moves = 0;
-    unsigned int combined_moves = combined_move_dispatch[i][state[i]];
-    int shadows = generate_shadow_mask(state, i);
-    moves |= (state[LOCATION_OF_EMPTY] & combined_moves & shadows);
-    result += __builtin_popcount(moves);
+    result += __builtin_popcount(state[LOCATION_OF_EMPTY] & generate_reach(state, i, false));
   }
   return result;
 }
 
-int Player::eval(const State_t &state) {
+int Player::eval(const Position &position) {
+  // The hash doesn't cover the move number, which eval depends on through the phase
+  unsigned long long key = position.get_hash() ^ zobrist_table.get_phase_key(game_phase(position[MOVE_NUMBER]));
+  int value;
+  if (!eval_cache.probe(key, value)) {
+    value = calculate_eval(position);
+    eval_cache.store(key, value);
+  }
+  return value;
+}
+
+int Player::calculate_eval(const Position &position) {
+  const Board &state = position.get_board();
   int result = 0;
 
-  // Material value
-  result += calculate_material_value(state);
+  // Material value, kept up to date by the Position
+  result += position.get_material_value();
 
-  // Heuristic Value
-  result += calculate_heuristic_value(state);
+  // Heuristic Value, the piece-square part of which is kept up to date by the Position
+  result += position.get_piece_square_value();
+  result += calculate_pawn_structure_value(position);
 
   // Opponent mobility
   // Number of opponent attacks
@@ -483,12 +324,6 @@ int Player::eval(const State_t &state) {
   return result;
 }
 
-bool Player::is_terminal(const State_t &state) {
-  return (state[MOVE_NUMBER] == 41)
-         || (state[BLACK_KING] == 0)
-         || (state[WHITE_KING] == 0);
-}
-
 
 /**
  * This uses a little help from Stack Overflow:
@@ -496,8 +331,12 @@ bool Player::is_terminal(const State_t &state) {
  * @param state
  * @return
  */
-void Player::set_time_limit(const State_t &state) {
+void Player::set_time_limit(const Board &state) {
   using namespace std::chrono;
+  if (depth_limit) {
+    timelimit = std::numeric_limits<long long>::max();
+    return;
+  }
   // Get current time with precision of milliseconds
   auto now = time_point_cast<milliseconds>(system_clock::now());
   // Calculate the time limits;
@@ -539,6 +378,31 @@ void Player::set_time_limit(const State_t &state) {
   timelimit = now.time_since_epoch().count() + 2333ll;
 }
 
+/**
+ * Seed the generator that shuffles move ordering.
+ *
+ * @param seed
+ */
+void Player::seed(unsigned int seed) {
+  mt.seed(seed);
+}
+
+/**
+ * Stop iterative deepening at a fixed depth instead of at the time limit.
+ *
+ * @param depth The deepest iteration, 0 to go by the clock.
+ */
+void Player::set_depth_limit(int depth) {
+  depth_limit = depth;
+}
+
+/**
+ * @return The number of nodes the last search visited.
+ */
+int Player::get_number_of_nodes() const {
+  return number_of_nodes;
+}
+
 long long Player::get_millisecond_time() {
   using namespace std::chrono;
   // Get current time with precision of milliseconds
@@ -6,9 +6,27 @@
 #define MOVE_GENERATOR_PLAYER_H
 
 #include <random>
+#include <vector>
+#include "Board.h"
+#include "Hash_Cache.h"
 #include "Move.h"
+#include "Move_List.h"
+#include "Position.h"
+#include "Zobrist_Table.h"
 #include "bitboard_tables.h"
 
+/**
+ * The number of entries in the pawn table. It is small enough to stay in
+ * the cache, and most positions in a search share their pawns with many
+ * others.
+ */
+#define PAWN_TABLE_ENTRIES (1u << 14)
+
+/**
+ * The number of entries in the eval cache.
+ */
+#define EVAL_CACHE_ENTRIES (1u << 16)
+
 /**
  * The pure abstract base player.
  */
@@ -22,46 +40,72 @@ public:
    */
   virtual std::string get_move_string(const std::string &state_string) = 0;
 
-  State_t make_move(const State_t &state, const Move &move);
-
   virtual ~Player() = default;
 
-protected:
-  State_t parse_input(const std::string &input);
+  /**
+   * Seed the move ordering shuffle, so that searches are repeatable from run
+   * to run. The Zobrist keys are fixed already.
+   *
+   * @param seed
+   */
+  void seed(unsigned int seed);
 
-  std::vector<std::string> generate_all_move_strings(const State_t &state);
+  /**
+   * Search to a fixed depth instead of until the clock runs out. Only the
+   * iterative deepening players use it.
+   *
+   * @param depth The deepest iteration, 0 to go by the clock.
+   */
+  void set_depth_limit(int depth);
 
-  std::vector<Move> generate_all_moves(const State_t &state);
+  /**
+   * @return The number of nodes the last get_move_string searched.
+   */
+  int get_number_of_nodes() const;
 
-  int eval(const State_t &state);
+protected:
+  /**
+   * The benchmarks time eval and move generation on their own, outside of a search.
+   */
+  friend class Benchmark;
 
-  int generate_shadow_mask(const State_t &state, int mover_pos);
+  std::vector<std::string> generate_all_move_strings(const Board &state);
 
-  std::vector<std::string>
-  generate_attack_strings(const State_t &state, int mover_index, int shadow_mask, const std::string &move_string);
+  void generate_all_moves(Position &position, Move_List &moves);
 
-  std::vector<std::string>
-  generate_move_strings(const State_t &state, int mover_index, int shadow_mask, const std::string &move_string);
+  /**
+   * @param position
+   * @return The value of the position for the side on move, from the eval
+   *         cache if it has been evaluated before.
+   */
+  int eval(const Position &position);
 
-  std::vector<Move>
-  generate_attacks(const State_t &state, int mover_index, int shadow_mask, const std::string &move_string);
+  int calculate_eval(const Position &position);
 
-  std::vector<Move>
-  generate_moves(const State_t &state, int mover_index, int shadow_mask, const std::string &move_string);
+  unsigned int generate_reach(const Board &state, int mover_index, bool attack);
+
+  std::vector<std::string>
+  generate_attack_strings(const Board &state, int mover_index);
 
-  int calculate_material_value(const State_t &state);
+  std::vector<std::string>
+  generate_move_strings(const Board &state, int mover_index);
 
-  State_t make_attack(const State_t &state, int attacker_index, int target_index);
+  void generate_attacks(Position &position, int mover_index, Move_List &result);
 
-  int calculate_heuristic_value(const State_t &state);
+  void generate_moves(Position &position, int mover_index, Move_List &result);
 
-  State_t make_move(const State_t &state, int mover_index, int dest_pos);
+  /**
+   * @param position
+   * @return The pawn structure value for the side on move, from the pawn
+   *         table if the pawns have been seen before.
+   */
+  int calculate_pawn_structure_value(const Position &position);
 
-  int calculate_number_of_attacks(const State_t &state, int idx, bool opponent);
+  int calculate_number_of_attacks(const Board &state, int idx, bool opponent);
 
-  int calculate_number_of_moves(const State_t &state, int idx);
+  int calculate_number_of_moves(const Board &state, int idx);
 
-  State_t current_state{};
+  Board current_state{};
   int number_of_nodes = 0;
   unsigned int my_player_color = 0;
   std::random_device rd;
@@ -69,10 +113,18 @@ protected:
   long long timecounter{0ll};
   long long timecache{0ll};
   long long timelimit{0ll};
+  int depth_limit{0};
+  Zobrist_Table zobrist_table;
+  /**
+   * Pawn structure values, white's less black's, keyed by the pawn hash.
+   */
+  Hash_Cache pawn_table{PAWN_TABLE_ENTRIES};
+  /**
+   * Eval keyed by the hash of the position and the key of its phase.
+   */
+  Hash_Cache eval_cache{EVAL_CACHE_ENTRIES};
 
-  bool is_terminal(const State_t &state);
-
-  void set_time_limit(const State_t &state);
+  void set_time_limit(const Board &state);
 
   long long int get_millisecond_time();
 };
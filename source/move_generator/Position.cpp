@@ -0,0 +1,184 @@
+#include "Position.h"
+#include "bitboard_tables.h"
+
+Position::Position(const Board &board, const Zobrist_Table &zobrist_table)
+    : board(board), zobrist_table(&zobrist_table), hash(zobrist_table.hash_state(board)),
+      pawn_hash(zobrist_table.hash_pawns(board)) {
+  for (int i = 0; i < 20; ++i) {
+    occupancy[i < 10 ? 2 : 1] |= board[i] & BOARD_MASK;
+    add_eval_terms(i, board[i], 1);
+  }
+  update_board_masks();
+}
+
+const Board &Position::get_board() const {
+  return board;
+}
+
+unsigned int Position::get_occupancy(unsigned int color) const {
+  return occupancy[color];
+}
+
+unsigned int Position::get_occupied() const {
+  return occupancy[1] | occupancy[2];
+}
+
+unsigned long long int Position::get_hash() const {
+  return hash;
+}
+
+unsigned long long int Position::get_pawn_hash() const {
+  return pawn_hash;
+}
+
+int Position::get_material_value() const {
+  return material[board[PLAYER_ON_MOVE]];
+}
+
+int Position::get_piece_square_value() const {
+  int value = piece_square[game_phase(board[MOVE_NUMBER])];
+  return (board[PLAYER_ON_MOVE] == 1) ? value : -value;
+}
+
+void Position::add_eval_terms(int slot, unsigned int position, int sign) {
+  material[1] += sign * piece_material_value(1, slot, position);
+  material[2] += sign * piece_material_value(2, slot, position);
+  int side_sign = (slot < 10) ? -sign : sign;
+  for (int phase = 0; phase < 3; ++phase) {
+    piece_square[phase] += side_sign * piece_square_value(phase, slot, position);
+  }
+}
+
+void Position::update_board_masks() {
+  board[LOCATION_OF_OPPONENTS] = occupancy[opponent[board[PLAYER_ON_MOVE]]];
+  board[LOCATION_OF_EMPTY] = ~(occupancy[1] | occupancy[2]) & BOARD_MASK;
+}
+
+void Position::generate_moves(Move_List &moves) const {
+  const Board &state = board;
+  unsigned int occupied = get_occupied();
+  unsigned int opponents = occupancy[opponent[state[PLAYER_ON_MOVE]]];
+  int first = my_player_index[state[PLAYER_ON_MOVE]];
+  moves.clear();
+  for (int mover_index = first, end = first + 10; mover_index < end; ++mover_index) {
+    if (!state[mover_index]) {
+      continue;
+    }
+    int type = piece_type(mover_index, state[mover_index]);
+    int square = to_square(state[mover_index]);
+    for (unsigned int attacks = piece_reach(type, true, square, occupied) & opponents; attacks; attacks &= attacks - 1) {
+      unsigned int end_pos = attacks & -attacks;
+      int target_index = opponent_player_index[state[PLAYER_ON_MOVE]];
+      for (; end_pos != (BOARD_MASK & state[target_index]); ++target_index);
+      moves.push_back(Move(mover_index, target_index, end_pos, 0, promotes(mover_index, end_pos)));
+    }
+    for (unsigned int quiets = piece_reach(type, false, square, occupied) & ~occupied & BOARD_MASK; quiets;
+         quiets &= quiets - 1) {
+      unsigned int end_pos = quiets & -quiets;
+      moves.push_back(Move(mover_index, -1, end_pos, 0, promotes(mover_index, end_pos)));
+    }
+  }
+}
+
+int Position::count_moves() const {
+  const Board &state = board;
+  unsigned int occupied = get_occupied();
+  unsigned int opponents = occupancy[opponent[state[PLAYER_ON_MOVE]]];
+  int result = 0;
+  for (int mover_index = my_player_index[state[PLAYER_ON_MOVE]], end = mover_index + 10;
+       mover_index < end; ++mover_index) {
+    int type = piece_type(mover_index, state[mover_index]);
+    int square = to_square(state[mover_index]);
+    result += __builtin_popcount(piece_reach(type, true, square, occupied) & opponents);
+    result += __builtin_popcount(piece_reach(type, false, square, occupied) & ~occupied & BOARD_MASK);
+  }
+  return result;
+}
+
+unsigned long long int Position::get_hash_after(const Move &move) const {
+  int mover_index = move.get_mover_idx();
+  unsigned int to = move.get_end_pos();
+  unsigned long long result = hash ^ zobrist_table->get_black_key()
+                              ^ zobrist_table->piece_key(mover_index, board[mover_index])
+                              ^ zobrist_table->piece_key(mover_index, move.is_promotion() ? to | PROMOTED_PAWN : to);
+  if (move.is_attack()) {
+    result ^= zobrist_table->piece_key(move.get_target_idx(), board[move.get_target_idx()]);
+  }
+  return result;
+}
+
+/**
+ * The same rules as the old copy-make: the mover lands on the destination,
+ * a pawn on the promotion ranks is marked as promoted and any other piece
+ * loses the mark, the captured piece is zeroed, then the side on move and
+ * the move number advance. The new hash comes from get_hash_after, so the
+ * Zobrist update is written once. The pawn hash loses the pawn keys of the
+ * mover and any captured piece and gains the mover's new pawn key. Pawn keys
+ * are 0 for anything but a pawn, so it only changes when a pawn moves,
+ * promotes or is captured. The eval sums swap the old values of the mover
+ * and any captured piece for their new ones.
+ *
+ * @param move
+ */
+void Position::do_move(const Move &move) {
+  do_move(move, get_hash_after(move));
+}
+
+void Position::do_move(const Move &move, unsigned long long hash_after) {
+  int mover_index = move.get_mover_idx();
+  unsigned int color = board[PLAYER_ON_MOVE];
+  unsigned int to = move.get_end_pos();
+
+  Undo &undo = undo_stack[ply++];
+  undo.move = move;
+  undo.mover = board[mover_index];
+  undo.hash = hash;
+  undo.pawn_hash = pawn_hash;
+  undo.material = material;
+  undo.piece_square = piece_square;
+
+  occupancy[color] ^= (board[mover_index] & BOARD_MASK) | to;
+  hash = hash_after;
+  pawn_hash ^= zobrist_table->pawn_key(mover_index, board[mover_index]);
+  add_eval_terms(mover_index, board[mover_index], -1);
+  if (move.is_attack()) {
+    undo.captured = board[move.get_target_idx()];
+    pawn_hash ^= zobrist_table->pawn_key(move.get_target_idx(), undo.captured);
+    add_eval_terms(move.get_target_idx(), undo.captured, -1);
+    add_eval_terms(move.get_target_idx(), 0, 1);
+    board[move.get_target_idx()] = 0;
+    occupancy[opponent[color]] ^= to;
+  }
+
+  board[mover_index] = move.is_promotion() ? to | PROMOTED_PAWN : to;
+  pawn_hash ^= zobrist_table->pawn_key(mover_index, board[mover_index]);
+  add_eval_terms(mover_index, board[mover_index], 1);
+  board[PLAYER_ON_MOVE] = opponent[color];
+  ++board[MOVE_NUMBER];
+  update_board_masks();
+}
+
+void Position::undo_move() {
+  const Undo &undo = undo_stack[--ply];
+  unsigned int color = opponent[board[PLAYER_ON_MOVE]];
+  unsigned int to = undo.move.get_end_pos();
+
+  occupancy[color] ^= (undo.mover & BOARD_MASK) | to;
+  board[undo.move.get_mover_idx()] = undo.mover;
+  if (undo.move.is_attack()) {
+    board[undo.move.get_target_idx()] = undo.captured;
+    occupancy[opponent[color]] ^= to;
+  }
+
+  board[PLAYER_ON_MOVE] = color;
+  --board[MOVE_NUMBER];
+  hash = undo.hash;
+  pawn_hash = undo.pawn_hash;
+  material = undo.material;
+  piece_square = undo.piece_square;
+  update_board_masks();
+}
+
+int Position::get_ply() const {
+  return ply;
+}
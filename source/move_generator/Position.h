@@ -0,0 +1,174 @@
+#ifndef MOVE_GENERATOR_POSITION_H
+#define MOVE_GENERATOR_POSITION_H
+
+#include <array>
+#include <cstddef>
+#include "Board.h"
+#include "Move.h"
+#include "Move_List.h"
+#include "Zobrist_Table.h"
+
+/**
+ * The deepest the search can go below the root. Iterative deepening stops at
+ * move 41, and ordering the children of a leaf takes one more ply.
+ */
+#define MAX_PLY 64
+
+/**
+ * A Board that the search changes in place. do_move plays a move on the
+ * Board and records what it needs to take the move back on a fixed size
+ * stack, and undo_move pops the stack. A search keeps a single Position for
+ * the whole tree instead of copying a new Board for every node.
+ *
+ * The occupancy of each side is kept alongside the Board and updated with a
+ * couple of xors per move. The opponent and empty words of the Board are
+ * derived from it, so they are always consistent with the pieces. The
+ * Zobrist hash, the hash of the pawns and the material and piece-square
+ * parts of eval are kept as running sums in the same way.
+ */
+class Position {
+public:
+  /**
+   * @param board The root state. The opponent and empty words are rebuilt
+   *              from the pieces, so they don't need to be trusted.
+   * @param zobrist_table The keys used to hash the position. It must outlive the Position.
+   */
+  Position(const Board &board, const Zobrist_Table &zobrist_table);
+
+  const Board &get_board() const;
+
+  /**
+   * @param color The PLAYER ON MOVE value of a side {1 WHITE, 2 BLACK}.
+   * @return Every square occupied by that side's pieces.
+   */
+  unsigned int get_occupancy(unsigned int color) const;
+
+  /**
+   * @return Every occupied square.
+   */
+  unsigned int get_occupied() const;
+
+  /**
+   * @return The Zobrist hash of the Board, kept up to date by do_move and undo_move.
+   */
+  unsigned long long int get_hash() const;
+
+  /**
+   * @param move A move generated from the current Board.
+   * @return The hash the Board will have once the move is made, without
+   *         making it.
+   */
+  unsigned long long int get_hash_after(const Move &move) const;
+
+  /**
+   * @return The Zobrist hash of the pawns alone, kept up to date by do_move
+   *         and undo_move. See Zobrist_Table::pawn_key.
+   */
+  unsigned long long int get_pawn_hash() const;
+
+  /**
+   * @return The material value of the Board for the side on move.
+   */
+  int get_material_value() const;
+
+  /**
+   * @return The piece-square value of the Board for the side on move, in
+   *         the phase of the game given by the move number.
+   */
+  int get_piece_square_value() const;
+
+  unsigned int operator[](std::size_t i) const { return board[i]; }
+
+  /**
+   * Generate all of the moves for the side on move, attacks first, without
+   * scoring or ordering them. The players order their moves by eval; this is
+   * the raw generator, for perft and the benchmarks.
+   *
+   * @param moves Filled with the moves.
+   */
+  void generate_moves(Move_List &moves) const;
+
+  /**
+   * @return The number of moves the side on move has, without generating them.
+   */
+  int count_moves() const;
+
+  /**
+   * Make a move generated from the current Board.
+   *
+   * @param move
+   */
+  void do_move(const Move &move);
+
+  /**
+   * Make a move whose hash is already known, because the caller worked it
+   * out with get_hash_after to prefetch the child's table entry.
+   *
+   * @param move
+   * @param hash_after get_hash_after(move).
+   */
+  void do_move(const Move &move, unsigned long long hash_after);
+
+  /**
+   * Take back the last move made with do_move.
+   */
+  void undo_move();
+
+  /**
+   * @return The number of moves on the undo stack.
+   */
+  int get_ply() const;
+
+private:
+  /**
+   * Everything do_move changes that can't be worked out again from the move.
+   */
+  struct Undo {
+    Move move;
+    unsigned int mover{0};
+    unsigned int captured{0};
+    unsigned long long hash{0ull};
+    unsigned long long pawn_hash{0ull};
+    std::array<int, 3> material{};
+    std::array<int, 3> piece_square{};
+  };
+
+  /**
+   * Write the opponent and empty words of the Board from the occupancy.
+   */
+  void update_board_masks();
+
+  /**
+   * Add (sign 1) or remove (sign -1) the material and piece-square values
+   * of a piece to the running sums.
+   *
+   * @param slot The index of the piece in the Board.
+   * @param position The Board word at that index.
+   * @param sign
+   */
+  void add_eval_terms(int slot, unsigned int position, int sign);
+
+  Board board;
+  /**
+   * Occupancy of each side, indexed by the PLAYER ON MOVE value. Index 0 is unused.
+   */
+  std::array<unsigned int, 3> occupancy{};
+  const Zobrist_Table *zobrist_table;
+  unsigned long long hash{0ull};
+  unsigned long long pawn_hash{0ull};
+  /**
+   * Running material sums for each side on move, indexed like occupancy,
+   * using white_on_move_values and black_on_move_values respectively.
+   */
+  std::array<int, 3> material{};
+  /**
+   * Running piece-square sums for each phase of the game, white's pieces
+   * minus black's.
+   */
+  std::array<int, 3> piece_square{};
+  std::array<Undo, MAX_PLY> undo_stack{};
+  int ply{0};
+};
+
+
+#endif //MOVE_GENERATOR_POSITION_H
@@ -2,44 +2,260 @@
 // Created by Michael Lane on 5/28/17.
 //
 
-#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <unistd.h>
 #include "TTable.h"
+#include "Zobrist_Table.h"
+
+static const char TTABLE_FILE_MAGIC[8] = {'M', 'C', 'T', 'T', 'A', 'B', 'L', 'E'};
+
+/**
+ * How many plies of depth one generation of age is worth when choosing an
+ * entry to replace. An entry from the last search is kept over one from
+ * this search only if it is this much deeper.
+ */
+static const int AGE_WEIGHT = 8;
+
+/**
+ * The number of buckets get_fill looks at.
+ */
+static const std::size_t FILL_SAMPLE = 1024;
+
+/**
+ * Ask the kernel how much of a mapping it has really backed with
+ * transparent huge pages. madvise succeeding only means the advice was
+ * taken: in madvise mode the kernel still falls back to small pages when it
+ * has no huge pages free.
+ *
+ * @param address An address in the mapping.
+ * @return The AnonHugePages of the mapping in /proc/self/smaps, in bytes,
+ *         or 0 if it can't be read.
+ */
+static std::size_t huge_page_bytes(const void *address) {
+  auto target = reinterpret_cast<unsigned long long>(address);
+  std::ifstream smaps("/proc/self/smaps");
+  std::string line;
+  bool in_mapping = false;
+  while (std::getline(smaps, line)) {
+    unsigned long long start = 0;
+    unsigned long long end = 0;
+    char dash = 0;
+    std::istringstream fields(line);
+    // Each mapping starts with a line like "7f2a00000000-7f2a40000000 rw-p ..."
+    if (fields >> std::hex >> start >> dash >> end && dash == '-') {
+      in_mapping = start <= target && target < end;
+    } else if (in_mapping && !line.compare(0, 14, "AnonHugePages:")) {
+      std::size_t kilobytes = 0;
+      std::istringstream(line.substr(14)) >> kilobytes;
+      return kilobytes << 10;
+    }
+  }
+  return 0;
+}
+
+TTable::TTable(std::size_t megabytes, const std::string &path) {
+  number_of_buckets = std::max<std::size_t>(1, (megabytes << 20) / sizeof(TTable_Bucket));
+  // Round down to a power of two so the hash can be masked into an index
+  while (number_of_buckets & (number_of_buckets - 1)) {
+    number_of_buckets &= number_of_buckets - 1;
+  }
+  mask = number_of_buckets - 1;
+
+  if (path.empty() || !map_file(path)) {
+    allocate();
+  }
+}
+
+TTable::~TTable() {
+  if (header) {
+    munmap(header, TTABLE_FILE_HEADER_SIZE + get_size());
+    close(file);
+  } else {
+    std::free(buckets);
+  }
+}
+
+void TTable::allocate() {
+  std::size_t size = get_size();
+  void *memory = nullptr;
+  if (posix_memalign(&memory, size >= HUGE_PAGE_SIZE ? HUGE_PAGE_SIZE : alignof(TTable_Bucket), size)) {
+    throw std::bad_alloc();
+  }
+  bool advised = false;
+#ifdef MADV_HUGEPAGE
+  // Ask before the table is first touched, so the pages are huge from the start
+  advised = size >= HUGE_PAGE_SIZE && madvise(memory, size, MADV_HUGEPAGE) == 0;
+#endif
+  buckets = static_cast<TTable_Bucket *>(memory);
+  for (std::size_t i = 0; i < number_of_buckets; ++i) {
+    new(&buckets[i]) TTable_Bucket();
+  }
+  // Every page has been touched now, so the kernel has decided how to back them
+  huge_page_size = advised ? huge_page_bytes(memory) : 0;
+}
+
+bool TTable::map_file(const std::string &path) {
+  file = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+  if (file < 0) {
+    return false;
+  }
+  // Two processes writing the same entries would tear them
+  if (flock(file, LOCK_EX | LOCK_NB)) {
+    close(file);
+    file = -1;
+    return false;
+  }
+
+  std::size_t size = TTABLE_FILE_HEADER_SIZE + get_size();
+  TTable_File_Header saved{};
+  bool reuse = pread(file, &saved, sizeof(saved), 0) == sizeof(saved)
+               && !std::memcmp(saved.magic, TTABLE_FILE_MAGIC, sizeof(saved.magic))
+               && saved.version == TTABLE_FILE_VERSION
+               && saved.eval_version == EVAL_VERSION
+               && saved.bucket_size == sizeof(TTable_Bucket)
+               && saved.zobrist_fingerprint == zobrist_fingerprint()
+               && saved.number_of_buckets == number_of_buckets;
+  // Truncating to nothing first leaves a sparse file of zeros, which are empty entries
+  if ((!reuse && ftruncate(file, 0)) || ftruncate(file, static_cast<off_t>(size))) {
+    close(file);
+    file = -1;
+    return false;
+  }
+  void *mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+  if (mapping == MAP_FAILED) {
+    close(file);
+    file = -1;
+    return false;
+  }
+
+  header = static_cast<TTable_File_Header *>(mapping);
+  buckets = reinterpret_cast<TTable_Bucket *>(static_cast<char *>(mapping) + TTABLE_FILE_HEADER_SIZE);
+  if (reuse) {
+    generation = header->generation;
+  } else {
+    std::memcpy(header->magic, TTABLE_FILE_MAGIC, sizeof(header->magic));
+    header->version = TTABLE_FILE_VERSION;
+    header->eval_version = EVAL_VERSION;
+    header->bucket_size = sizeof(TTable_Bucket);
+    header->zobrist_fingerprint = zobrist_fingerprint();
+    header->number_of_buckets = number_of_buckets;
+    header->generation = generation;
+  }
+  return true;
+}
 
 /**
  * Insert a state into the ttable.
  *
+ * An entry for the same state is overwritten if it is from an earlier
+ * search or the new one searched at least as deep. Otherwise its deeper
+ * value is kept, but it takes the new best move and the current age.
+ * A new state goes in an empty entry if the bucket has one, and otherwise
+ * replaces the entry with the lowest depth less AGE_WEIGHT for every
+ * generation it is behind.
+ *
  * @param new_entry
- * @param state
+ * @param hash The Zobrist hash of the state.
  */
-void TTable::insert(TTable_Entry &new_entry, const State_t &state) {
-  unsigned long long hash = zobrist_table.hash_state(state);
+void TTable::insert(TTable_Entry &new_entry, unsigned long long hash) {
   new_entry.setHash(hash);
-  unsigned long long key = hash & mask;
-  TTable_Entry existing_entry = entries[key];
-  if (!existing_entry.isValid()) {
-    entries[key] = new_entry;
-    return;
+  new_entry.setAge(generation);
+  TTable_Entry *entries = buckets[hash & mask].entries;
+  TTable_Entry *replace = nullptr;
+  int replace_worth = 0;
+  TTABLE_COUNT(stores);
+  for (int i = 0; i < TTABLE_BUCKET_ENTRIES; ++i) {
+    // The generation wraps, so the difference is taken in 8 bits as well
+    uint8_t age = static_cast<uint8_t>(generation - entries[i].getAge());
+    if (entries[i].isValid() && entries[i].getHash() == hash) {
+      if (age || new_entry.getDepth() >= entries[i].getDepth()) {
+        entries[i] = new_entry;
+      } else {
+        entries[i].setMove(new_entry.getMove());
+        entries[i].setAge(generation);
+        TTABLE_COUNT(kept_deeper);
+      }
+      return;
+    }
+    if (replace && !replace->isValid()) {
+      continue;
+    }
+    int worth = entries[i].getDepth() - AGE_WEIGHT * age;
+    if (!replace || !entries[i].isValid() || worth < replace_worth) {
+      replace = &entries[i];
+      replace_worth = worth;
+    }
   }
-
-  if (new_entry.getDepth() >= existing_entry.getDepth()) {
-    entries[key] = new_entry;
+  if (replace->isValid()) {
+    TTABLE_COUNT(replacements);
   }
+  *replace = new_entry;
 }
 
 /**
  * Return an entry from the hash table.
  *
- * @param state
- * @return
+ * @param hash The Zobrist hash of the state.
+ * @return The entry, or an invalid entry if the state isn't in the table.
  */
-TTable_Entry TTable::get_entry(const State_t &state) {
-  unsigned long long hash = zobrist_table.hash_state(state);
-  TTable_Entry entry = entries[hash & mask];
-  if (entry.getHash() == hash) {
-    return entry;
-  } else {
-    return {};
+TTable_Entry TTable::get_entry(unsigned long long hash) const {
+  TTABLE_COUNT(probes);
+  for (const TTable_Entry &entry : buckets[hash & mask].entries) {
+    if (entry.getHash() == hash) {
+      TTABLE_COUNT(hits);
+      return entry;
+    }
   }
+#ifndef NO_TTABLE_STATS
+  for (const TTable_Entry &entry : buckets[hash & mask].entries) {
+    if (entry.isValid()) {
+      TTABLE_COUNT(key_rejects);
+      break;
+    }
+  }
+#endif
+  return {};
 }
 
+void TTable::new_search() {
+  ++generation;
+  stats = TTable_Stats();
+  if (header) {
+    header->generation = generation;
+  }
+}
 
+const TTable_Stats &TTable::get_stats() const {
+  return stats;
+}
+
+double TTable::get_fill(bool current_only) const {
+  std::size_t sample = std::min(number_of_buckets, FILL_SAMPLE);
+  std::size_t used = 0;
+  for (std::size_t i = 0; i < sample; ++i) {
+    for (const TTable_Entry &entry : buckets[i].entries) {
+      used += entry.isValid() && (!current_only || entry.getAge() == generation);
+    }
+  }
+  return 100.0 * used / (sample * TTABLE_BUCKET_ENTRIES);
+}
+
+std::size_t TTable::get_size() const {
+  return number_of_buckets * sizeof(TTable_Bucket);
+}
+
+std::size_t TTable::get_huge_page_size() const {
+  return huge_page_size;
+}
+
+bool TTable::isPersistent() const {
+  return header != nullptr;
+}
@@ -5,24 +5,234 @@
 #ifndef MOVE_GENERATOR_TTABLE_H
 #define MOVE_GENERATOR_TTABLE_H
 
-#include <unordered_map>
-#include <random>
+#include <cstddef>
+#include <cstdint>
+#include <string>
 #include "TTable_Entry.h"
-#include "Zobrist_Table.h"
+
+/**
+ * The size of a transposition table when none is given, in megabytes.
+ */
+#define TTABLE_DEFAULT_MB 16
+
+/**
+ * The number of entries that share a bucket.
+ */
+#define TTABLE_BUCKET_ENTRIES 4
+
+/**
+ * A cache line of entries. A hash maps to one bucket, so a probe touches a
+ * single line whichever entry it finds.
+ */
+struct alignas(64) TTable_Bucket {
+  TTable_Entry entries[TTABLE_BUCKET_ENTRIES];
+};
+
+static_assert(sizeof(TTable_Bucket) == 64, "A bucket must fill exactly one cache line");
+
+/**
+ * The size of a transparent huge page. Tables at least this big are aligned
+ * to it so the kernel can back them with huge pages.
+ */
+#define HUGE_PAGE_SIZE (2u << 20)
+
+/**
+ * The version of a persistent table file. Bump it whenever TTable_Entry,
+ * TTable_Bucket or TTable_File_Header changes, or how the search keys its
+ * entries, so old files are cleared instead of misread. A file is also
+ * cleared when its values came from another EVAL_VERSION or its hashes from
+ * other Zobrist keys, so those don't need a new version.
+ *
+ * 2: The header records the EVAL_VERSION.
+ * 3: Entries are keyed by the phase of the game as well as the state.
+ */
+#define TTABLE_FILE_VERSION 3
+
+/**
+ * The first page of a persistent table file. The buckets start on the next
+ * page.
+ */
+struct TTable_File_Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t eval_version;
+  uint32_t bucket_size;
+  unsigned long long zobrist_fingerprint;
+  unsigned long long number_of_buckets;
+  uint8_t generation;
+};
+
+#define TTABLE_FILE_HEADER_SIZE 4096
+
+static_assert(sizeof(TTable_File_Header) <= TTABLE_FILE_HEADER_SIZE, "The header must fit in its page");
+
+/**
+ * Counts of what the table and the search did with it since the last
+ * new_search. They are kept unless NO_TTABLE_STATS is defined.
+ */
+struct TTable_Stats {
+  unsigned long long probes{0ull};
+  unsigned long long hits{0ull};
+  /**
+   * Probes that missed in a bucket holding other states, whose keys didn't match.
+   */
+  unsigned long long key_rejects{0ull};
+  unsigned long long stores{0ull};
+  /**
+   * Stores that evicted another state's entry.
+   */
+  unsigned long long replacements{0ull};
+  /**
+   * Stores for a state already in the table that was searched deeper, so only
+   * its move and age were updated.
+   */
+  unsigned long long kept_deeper{0ull};
+  /**
+   * Nodes the search cut off with a value from the table, by the bound of the entry.
+   */
+  unsigned long long exact_cutoffs{0ull};
+  unsigned long long lower_cutoffs{0ull};
+  unsigned long long upper_cutoffs{0ull};
+};
+
+#ifdef NO_TTABLE_STATS
+#define TTABLE_COUNT(counter)
+#else
+#define TTABLE_COUNT(counter) (++stats.counter)
+#endif
 
 /**
  * The class that manages the transposition tables.
+ *
+ * The table is allocated once, at a fixed power of two number of buckets,
+ * and never grows. A new state always goes in, in an empty entry of its
+ * bucket if there is one and otherwise in place of the entry least worth
+ * keeping: the shallowest, once entries left over from earlier searches
+ * have been discounted by how many searches ago they were stored. The table stays useful over a whole game without being
+ * cleared, since the deep entries of old searches give way to new ones.
+ *
+ * A big table is aligned to huge pages and the kernel is asked to back it
+ * with them where it can, so that probes all over the table don't each miss
+ * the TLB.
+ *
+ * A table can instead be kept in a file that is mapped into memory, so that
+ * it outlives the process and the next game starts with everything the last
+ * one learned. The kernel writes the table back to the file, even if the
+ * process is killed. Only one process can have a file open at a time, and a
+ * file written with a different size, layout, eval or Zobrist keys is
+ * cleared.
  */
 class TTable {
 public:
-  void insert(TTable_Entry &new_entry, const State_t &state);
+  /**
+   * @param megabytes The most memory the table may use. It is rounded down
+   *                  to a power of two number of buckets.
+   * @param path The file to keep the table in, or empty to keep it in memory
+   *             only. If the file can't be opened and mapped, or another
+   *             process has it open, the table is kept in memory.
+   */
+  explicit TTable(std::size_t megabytes = TTABLE_DEFAULT_MB, const std::string &path = "");
+
+  ~TTable();
+
+  TTable(const TTable &) = delete;
+
+  TTable &operator=(const TTable &) = delete;
+
+  void insert(TTable_Entry &new_entry, unsigned long long hash);
 
-  TTable_Entry get_entry(const State_t &state);
+  TTable_Entry get_entry(unsigned long long hash) const;
+
+  /**
+   * Start loading the bucket of a state into the cache, so that it is there
+   * by the time get_entry or insert needs it. On a table much bigger than
+   * the cache nearly every probe misses, and this lets the miss overlap with
+   * other work.
+   *
+   * @param hash The Zobrist hash of the state.
+   */
+  void prefetch(unsigned long long hash) const {
+    __builtin_prefetch(&buckets[hash & mask]);
+  }
+
+  /**
+   * Start a new generation. Call it at the start of every search, so that
+   * entries from earlier searches are the first to be replaced.
+   */
+  void new_search();
+
+  /**
+   * Count a node the search cut off with the value of an entry.
+   *
+   * @param flag The bound of the entry.
+   */
+  void record_cutoff(ttable_flag flag) {
+    if (flag == EXACT_VALUE) {
+      TTABLE_COUNT(exact_cutoffs);
+    } else if (flag == LOWER_BOUND) {
+      TTABLE_COUNT(lower_cutoffs);
+    } else {
+      TTABLE_COUNT(upper_cutoffs);
+    }
+  }
+
+  /**
+   * @return The counts since the last new_search, all 0 if NO_TTABLE_STATS is defined.
+   */
+  const TTable_Stats &get_stats() const;
+
+  /**
+   * Estimate how full the table is from a sample of its buckets.
+   *
+   * @param current_only Only count the entries stored by the current search.
+   * @return The percentage of entries in use.
+   */
+  double get_fill(bool current_only) const;
+
+  /**
+   * @return The size of the table in bytes.
+   */
+  std::size_t get_size() const;
+
+  /**
+   * @return How many bytes of the table the kernel has backed with
+   *         transparent huge pages, as it reports in /proc/self/smaps.
+   */
+  std::size_t get_huge_page_size() const;
+
+  /**
+   * @return True if the table is kept in a file.
+   */
+  bool isPersistent() const;
 
 private:
-  Zobrist_Table zobrist_table;
-  unsigned long long mask{(1 << 21) - 1};
-  std::unordered_map<unsigned int, TTable_Entry> entries{};
+  void allocate();
+
+  /**
+   * Map the table from a file, reusing its entries if it was written by a
+   * table like this one.
+   *
+   * @param path
+   * @return False if the file couldn't be used.
+   */
+  bool map_file(const std::string &path);
+
+  TTable_Bucket *buckets{nullptr};
+  std::size_t number_of_buckets{0};
+  /**
+   * The mapping of a persistent table, starting with the header. It is
+   * null when the table is only in memory.
+   */
+  TTable_File_Header *header{nullptr};
+  int file{-1};
+  std::size_t huge_page_size{0};
+  unsigned long long mask{0ull};
+  /**
+   * The generation of the current search, stored as the age of the entries
+   * it inserts. It wraps around after 256 searches.
+   */
+  uint8_t generation{0};
+  mutable TTable_Stats stats;
 };
 
 #endif //MOVE_GENERATOR_TTABLE_H
@@ -2,6 +2,7 @@
 // Created by Michael Lane on 5/28/17.
 //
 
+#include <algorithm>
 #include "TTable_Entry.h"
 
 unsigned long long int TTable_Entry::getHash() const {
@@ -12,28 +13,12 @@ void TTable_Entry::setHash(unsigned long long int hash) {
   TTable_Entry::hash = hash;
 }
 
-int TTable_Entry::getA() const {
-  return a;
-}
-
-void TTable_Entry::setA(int a) {
-  TTable_Entry::a = a;
-}
-
-int TTable_Entry::getB() const {
-  return b;
-}
-
-void TTable_Entry::setB(int b) {
-  TTable_Entry::b = b;
-}
-
 int TTable_Entry::getValue() const {
   return value;
 }
 
 void TTable_Entry::setValue(int value) {
-  TTable_Entry::value = value;
+  TTable_Entry::value = static_cast<int16_t>(std::max(INT16_MIN + 1, std::min(INT16_MAX, value)));
 }
 
 bool TTable_Entry::isValid() const {
@@ -49,14 +34,30 @@ int TTable_Entry::getDepth() const {
 }
 
 void TTable_Entry::setDepth(int depth) {
-  TTable_Entry::depth = depth;
+  TTable_Entry::depth = static_cast<uint8_t>(std::max(0, std::min(UINT8_MAX, depth)));
 }
 
 ttable_flag TTable_Entry::getFlag() const {
-  return flag;
+  return static_cast<ttable_flag>(flag);
 }
 
 void TTable_Entry::setFlag(ttable_flag flag) {
-  TTable_Entry::flag = flag;
+  TTable_Entry::flag = static_cast<int8_t>(flag);
+}
+
+Move TTable_Entry::getMove() const {
+  return Move(move);
+}
+
+void TTable_Entry::setMove(const Move &move) {
+  TTable_Entry::move = move.get_data();
+}
+
+int TTable_Entry::getAge() const {
+  return age;
+}
+
+void TTable_Entry::setAge(int age) {
+  TTable_Entry::age = static_cast<uint8_t>(age);
 }
 
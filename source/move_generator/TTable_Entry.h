@@ -6,6 +6,8 @@
 #define MOVE_GENERATOR_TTABLE_ENTRY_H
 
 
+#include <cstdint>
+#include "Move.h"
 #include "bitboard_tables.h"
 
 enum ttable_flag {
@@ -16,6 +18,12 @@ enum ttable_flag {
 
 /**
  * The class that manages the transposition table entries.
+ *
+ * An entry is packed into 16 bytes so that four share a cache line: the
+ * full hash to check the entry against, the value in 16 bits, the best move
+ * in its 16 bit encoding, and a byte each for the depth, the bound, whether
+ * the entry is valid and the age of the search that stored it. Values and
+ * depths that don't fit are clamped.
  */
 class TTable_Entry {
 public:
@@ -23,14 +31,6 @@ public:
 
   void setHash(unsigned long long int hash);
 
-  int getA() const;
-
-  void setA(int a);
-
-  int getB() const;
-
-  void setB(int b);
-
   int getValue() const;
 
   void setValue(int value);
@@ -47,15 +47,25 @@ public:
 
   void setFlag(ttable_flag flag);
 
+  Move getMove() const;
+
+  void setMove(const Move &move);
+
+  int getAge() const;
+
+  void setAge(int age);
+
 private:
   unsigned long long hash{0ull};
-  int depth{0};
-  int a{0};
-  int b{0};
-  int value{0};
+  int16_t value{0};
+  uint16_t move{0};
+  uint8_t depth{0};
+  int8_t flag{EXACT_VALUE};
   bool valid{false};
-  ttable_flag flag{EXACT_VALUE};
+  uint8_t age{0};
 };
 
+static_assert(sizeof(TTable_Entry) == 16, "Four entries must fit in a cache line");
+
 
 #endif //MOVE_GENERATOR_TTABLE_ENTRY_H
@@ -6,7 +6,7 @@
 
 std::string Testing_Player::get_move_string(const std::string &state_string) {
   std::string result = "";
-  parse_input(state_string);
+  current_state = parse_input(state_string);
   std::vector<std::string> move_strings = generate_all_move_strings(current_state);
   for (std::string move_string : move_strings) {
     result += move_string;
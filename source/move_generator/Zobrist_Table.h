@@ -6,10 +6,76 @@
 #define MOVE_GENERATOR_ZOBRIST_TABLE_H
 
 
-#include <random>
 #include "bitboard_tables.h"
+#include "Board.h"
 
-typedef std::vector<unsigned int> State_t;
+/**
+ * The seed the Zobrist keys are drawn from. The keys are the same in every
+ * build and every run, so hashes can be saved and read back, as the
+ * persistent transposition table does. Changing it invalidates saved tables.
+ */
+#define ZOBRIST_SEED 0x6d696e6963686573ull
+
+/**
+ * The Zobrist keys. The pieces are indexed by square then
+ * piece_type_zobrist_index, and the NO_SQUARE row is left at 0 for captured
+ * pieces. The phase keys aren't part of the hash of a state. They tell
+ * apart the evals and table entries of the same state in different phases
+ * of the game.
+ */
+struct Zobrist_Keys {
+  unsigned long long black{0ull};
+  unsigned long long pieces[NUM_SQUARES + 1][12]{};
+  unsigned long long phases[3]{};
+};
+
+/**
+ * One step of the splitmix64 generator.
+ *
+ * @param state Advanced by the step.
+ * @return The next random number.
+ */
+constexpr unsigned long long splitmix64(unsigned long long &state) {
+  unsigned long long z = (state += 0x9e3779b97f4a7c15ull);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  return z ^ (z >> 31);
+}
+
+constexpr Zobrist_Keys make_zobrist_keys(unsigned long long seed) {
+  Zobrist_Keys keys{};
+  keys.black = splitmix64(seed);
+  for (int square = 0; square < NUM_SQUARES; ++square) {
+    for (int piece = 0; piece < 12; ++piece) {
+      keys.pieces[square][piece] = splitmix64(seed);
+    }
+  }
+  // Drawn last, so the keys above are the same as before they were added
+  for (unsigned long long &key : keys.phases) {
+    key = splitmix64(seed);
+  }
+  return keys;
+}
+
+inline constexpr Zobrist_Keys ZOBRIST_KEYS = make_zobrist_keys(ZOBRIST_SEED);
+
+/**
+ * @return A number that changes whenever any of the keys do, to tell
+ *         whether hashes saved by another build can be trusted.
+ */
+constexpr unsigned long long zobrist_fingerprint() {
+  unsigned long long fingerprint = ZOBRIST_KEYS.black;
+  for (const auto &square : ZOBRIST_KEYS.pieces) {
+    for (unsigned long long key : square) {
+      fingerprint = (fingerprint << 7 | fingerprint >> 57) ^ key;
+    }
+  }
+  // The transposition table is keyed with the phase keys too
+  for (unsigned long long key : ZOBRIST_KEYS.phases) {
+    fingerprint = (fingerprint << 7 | fingerprint >> 57) ^ key;
+  }
+  return fingerprint;
+}
 
 /**
  * The class that manages the zobrist table and hashing the states.
@@ -17,20 +83,45 @@ typedef std::vector<unsigned int> State_t;
 class Zobrist_Table {
 
 public:
-  Zobrist_Table();
+  unsigned long long int hash_state(const Board &state) const;
+
+  /**
+   * The key of a piece where it stands. Promoted pawns hash as queens of
+   * their color and captured pieces hash to 0, so a Board hashes to the xor
+   * of piece_key over its twenty pieces (and get_black_key when black is on
+   * move).
+   *
+   * @param slot The index of the piece in the Board.
+   * @param position The Board word at that index.
+   * @return
+   */
+  unsigned long long int piece_key(int slot, unsigned int position) const {
+    return ZOBRIST_KEYS.pieces[to_square(position)][(position & PROMOTED_PAWN) ? promoted_zobrist_index[slot >= 10]
+                                                                              : piece_type_zobrist_index[slot]];
+  }
 
-  unsigned long long int hash_state(State_t state);
+  /**
+   * The key of a piece in the pawn hash, which hashes the pawns and nothing
+   * else. It is the piece_key of a pawn that hasn't promoted and 0 for any
+   * other piece.
+   *
+   * @param slot The index of the piece in the Board.
+   * @param position The Board word at that index.
+   * @return
+   */
+  unsigned long long int pawn_key(int slot, unsigned int position) const {
+    return (4 < slot && slot < 15 && !(position & PROMOTED_PAWN)) ? piece_key(slot, position) : 0ull;
+  }
 
-  unsigned long long int
-  update_hash(unsigned long long int hash, int source_type, int source_loc, int dest_type, int dest_loc);
+  unsigned long long int hash_pawns(const Board &state) const;
 
-  unsigned long long int random_int();
+  unsigned long long int get_black_key() const;
 
-private:
-  std::random_device rd;
-  std::mt19937 mt{rd()};
-  unsigned long long zobrist_black;
-  unsigned long long table[30][13]{};
+  /**
+   * @param phase The phase of the game, see game_phase.
+   * @return The key to xor into the hash of a state to key its eval.
+   */
+  unsigned long long int get_phase_key(int phase) const;
 };
 
 
@@ -1,22 +1,27 @@
 //
 // Created by Michael Lane on 6/2/17.
-// This file requires the use of the --std=c++11 flag when compiling.
+// This file requires the use of the --std=c++17 flag when compiling.
 //
 // This file will definitely take some time to wrap your head around. As a tip
-// look at the keys and values in the unordered_maps as 30-bit binary values and
-// arrange those values in a 6x5 rectangle. Values that are greater than 1 << 30
-// are promoted pawns.
+// look at the masks as 30-bit binary values and arrange those values in a 6x5
+// rectangle. Positions that are greater than 1 << 30 are promoted pawns.
+//
+// Every table is a flat array indexed by square number, where the square
+// number of a position is the index of its set bit: 0 is e1, 4 is a1, 25 is
+// e6 and 29 is a6. Tables with a NUM_SQUARES + 1 dimension have an extra
+// entry for NO_SQUARE, the square of a piece that has been captured, so that
+// lookups never need to branch on a missing piece.
+//
+// The movement tables are generated at compile time from BOARD_WIDTH and
+// BOARD_HEIGHT, and every table is an inline constexpr variable, so there is
+// a single read-only copy shared by every translation unit and nothing to
+// initialize at startup.
 //
 
 #ifndef BITBOARD_TABLES_H
 #define BITBOARD_TABLES_H
 
-#include <vector>
-#include <tuple>
-#include <unordered_map>
-#include <string>
-#include <map>
-#include <queue>
+#include <array>
 
 #define BLACK_KING 0
 #define WHITE_KING 19
@@ -26,2682 +31,663 @@
 #define LOCATION_OF_EMPTY 23
 #define TIME_LEFT 24
 
-typedef std::unordered_map<unsigned int, std::vector<unsigned int>> Attack_Masks;
-typedef std::unordered_map<unsigned int, std::vector<unsigned int>> Move_Masks;
-typedef std::unordered_map<unsigned int, std::string> Int_to_Str;
-typedef std::unordered_map<unsigned int, int> Int_to_Idx;
-typedef std::unordered_map<unsigned int, std::unordered_map<unsigned int, unsigned int>> Shadow_Mask;
-typedef std::vector<unsigned int> State_t;
-
-static unsigned int BLACK_IDX = 0;
-static unsigned int WHITE_IDX = 10;
-
-static Int_to_Idx TO_IDX = {
-    {1610612736, 29},
-    {1342177280, 28},
-    {1207959552, 27},
-    {1140850688, 26},
-    {1107296256, 25},
-    {1090519040, 24},
-    {1082130432, 23},
-    {1077936128, 22},
-    {1075838976, 21},
-    {1074790400, 20},
-    {1074266112, 19},
-    {1074003968, 18},
-    {1073872896, 17},
-    {1073807360, 16},
-    {1073774592, 15},
-    {1073758208, 14},
-    {1073750016, 13},
-    {1073745920, 12},
-    {1073743872, 11},
-    {1073742848, 10},
-    {1073742336, 9},
-    {1073742080, 8},
-    {1073741952, 7},
-    {1073741888, 6},
-    {1073741856, 5},
-    {1073741840, 4},
-    {1073741832, 3},
-    {1073741828, 2},
-    {1073741826, 1},
-    {1073741825, 0},
-    {536870912,  29},
-    {268435456,  28},
-    {134217728,  27},
-    {67108864,   26},
-    {33554432,   25},
-    {16777216,   24},
-    {8388608,    23},
-    {4194304,    22},
-    {2097152,    21},
-    {1048576,    20},
-    {524288,     19},
-    {262144,     18},
-    {131072,     17},
-    {65536,      16},
-    {32768,      15},
-    {16384,      14},
-    {8192,       13},
-    {4096,       12},
-    {2048,       11},
-    {1024,       10},
-    {512,        9},
-    {256,        8},
-    {128,        7},
-    {64,         6},
-    {32,         5},
-    {16,         4},
-    {8,          3},
-    {4,          2},
-    {2,          1},
-    {1,          0},
-};
-
-static Int_to_Str TO_STR = {
-    {1610612736, "a6"},
-    {1342177280, "b6"},
-    {1207959552, "c6"},
-    {1140850688, "d6"},
-    {1107296256, "e6"},
-    {1090519040, "a5"},
-    {1082130432, "b5"},
-    {1077936128, "c5"},
-    {1075838976, "d5"},
-    {1074790400, "e5"},
-    {1074266112, "a4"},
-    {1074003968, "b4"},
-    {1073872896, "c4"},
-    {1073807360, "d4"},
-    {1073774592, "e4"},
-    {1073758208, "a3"},
-    {1073750016, "b3"},
-    {1073745920, "c3"},
-    {1073743872, "d3"},
-    {1073742848, "e3"},
-    {1073742336, "a2"},
-    {1073742080, "b2"},
-    {1073741952, "c2"},
-    {1073741888, "d2"},
-    {1073741856, "e2"},
-    {1073741840, "a1"},
-    {1073741832, "b1"},
-    {1073741828, "c1"},
-    {1073741826, "d1"},
-    {1073741825, "e1"},
-    {536870912,  "a6"},
-    {268435456,  "b6"},
-    {134217728,  "c6"},
-    {67108864,   "d6"},
-    {33554432,   "e6"},
-    {16777216,   "a5"},
-    {8388608,    "b5"},
-    {4194304,    "c5"},
-    {2097152,    "d5"},
-    {1048576,    "e5"},
-    {524288,     "a4"},
-    {262144,     "b4"},
-    {131072,     "c4"},
-    {65536,      "d4"},
-    {32768,      "e4"},
-    {16384,      "a3"},
-    {8192,       "b3"},
-    {4096,       "c3"},
-    {2048,       "d3"},
-    {1024,       "e3"},
-    {512,        "a2"},
-    {256,        "b2"},
-    {128,        "c2"},
-    {64,         "d2"},
-    {32,         "e2"},
-    {16,         "a1"},
-    {8,          "b1"},
-    {4,          "c1"},
-    {2,          "d1"},
-    {1,          "e1"},
-};
-
-static Attack_Masks KING_ATTACK_MASKS = {
-    {536870912, {268435456, 16777216,  8388608}},
-    {268435456, {536870912, 134217728, 16777216,  8388608,  4194304}},
-    {134217728, {268435456, 67108864,  8388608,   4194304,  2097152}},
-    {67108864,  {134217728, 33554432,  4194304,   2097152,  1048576}},
-    {33554432,  {67108864,  2097152,   1048576}},
-    {16777216,  {536870912, 268435456, 8388608,   524288,   262144}},
-    {8388608,   {536870912, 268435456, 134217728, 16777216, 4194304, 524288, 262144, 131072}},
-    {4194304,   {268435456, 134217728, 67108864,  8388608,  2097152, 262144, 131072, 65536}},
-    {2097152,   {134217728, 67108864,  33554432,  4194304,  1048576, 131072, 65536,  32768}},
-    {1048576,   {67108864,  33554432,  2097152,   65536,    32768}},
-    {524288,    {16777216,  8388608,   262144,    16384,    8192}},
-    {262144,    {16777216,  8388608,   4194304,   524288,   131072,  16384,  8192,   4096}},
-    {131072,    {8388608,   4194304,   2097152,   262144,   65536,   8192,   4096,   2048}},
-    {65536,     {4194304,   2097152,   1048576,   131072,   32768,   4096,   2048,   1024}},
-    {32768,     {2097152,   1048576,   65536,     2048,     1024}},
-    {16384,     {524288,    262144,    8192,      512,      256}},
-    {8192,      {524288,    262144,    131072,    16384,    4096,    512,    256,    128}},
-    {4096,      {262144,    131072,    65536,     8192,     2048,    256,    128,    64}},
-    {2048,      {131072,    65536,     32768,     4096,     1024,    128,    64,     32}},
-    {1024,      {65536,     32768,     2048,      64,       32}},
-    {512,       {16384,     8192,      256,       16,       8}},
-    {256,       {16384,     8192,      4096,      512,      128,     16,     8,      4}},
-    {128,       {8192,      4096,      2048,      256,      64,      8,      4,      2}},
-    {64,        {4096,      2048,      1024,      128,      32,      4,      2,      1}},
-    {32,        {2048,      1024,      64,        2,        1}},
-    {16,        {512,       256,       8}},
-    {8,         {512,       256,       128,       16,       4}},
-    {4,         {256,       128,       64,        8,        2}},
-    {2,         {128,       64,        32,        4,        1}},
-    {1,         {64,        32,        2}},
-};
-
-static Attack_Masks QUEEN_ATTACK_MASKS = {
-    {536870912, {268435456, 134217728, 67108864,  33554432, 16777216, 8388608, 524288,  131072, 16384,  2048,   512,   32,   16}},
-    {268435456, {536870912, 134217728, 67108864,  33554432, 16777216, 8388608, 4194304, 262144, 65536,  8192,   1024,  256,  8}},
-    {134217728, {536870912, 268435456, 67108864,  33554432, 8388608,  4194304, 2097152, 524288, 131072, 32768,  4096,  128,  4}},
-    {67108864,  {536870912, 268435456, 134217728, 33554432, 4194304,  2097152, 1048576, 262144, 65536,  16384,  2048,  64,   2}},
-    {33554432,  {536870912, 268435456, 134217728, 67108864, 2097152,  1048576, 131072,  32768,  8192,   1024,   512,   32,   1}},
-    {16777216,  {536870912, 268435456, 8388608,   4194304,  2097152,  1048576, 524288,  262144, 16384,  4096,   512,   64,   16,   1}},
-    {8388608,   {536870912, 268435456, 134217728, 16777216, 4194304,  2097152, 1048576, 524288, 262144, 131072, 8192,  2048, 256,  32,  8}},
-    {4194304,   {268435456, 134217728, 67108864,  16777216, 8388608,  2097152, 1048576, 262144, 131072, 65536,  16384, 4096, 1024, 128, 4}},
-    {2097152,   {134217728, 67108864,  33554432,  16777216, 8388608,  4194304, 1048576, 131072, 65536,  32768,  8192,  2048, 512,  64,  2}},
-    {1048576,   {67108864,  33554432,  16777216,  8388608,  4194304,  2097152, 65536,   32768,  4096,   1024,   256,   32,   16,   1}},
-    {524288,    {536870912, 134217728, 16777216,  8388608,  262144,   131072,  65536,   32768,  16384,  8192,   512,   128,  16,   2}},
-    {262144,    {268435456, 67108864,  16777216,  8388608,  4194304,  524288,  131072,  65536,  32768,  16384,  8192,  4096, 256,  64,  8,   1}},
-    {131072,    {536870912, 134217728, 33554432,  8388608,  4194304,  2097152, 524288,  262144, 65536,  32768,  8192,  4096, 2048, 512, 128, 32, 4}},
-    {65536,     {268435456, 67108864,  4194304,   2097152,  1048576,  524288,  262144,  131072, 32768,  4096,   2048,  1024, 256,  64,  16,  2}},
-    {32768,     {134217728, 33554432,  2097152,   1048576,  524288,   262144,  131072,  65536,  2048,   1024,   128,   32,   8,    1}},
-    {16384,     {536870912, 67108864,  16777216,  4194304,  524288,   262144,  8192,    4096,   2048,   1024,   512,   256,  16,   4}},
-    {8192,      {268435456, 33554432,  8388608,   2097152,  524288,   262144,  131072,  16384,  4096,   2048,   1024,  512,  256,  128, 8,   2}},
-    {4096,      {134217728, 16777216,  4194304,   1048576,  262144,   131072,  65536,   16384,  8192,   2048,   1024,  256,  128,  64,  16,  4,  1}},
-    {2048,      {536870912, 67108864,  8388608,   2097152,  131072,   65536,   32768,   16384,  8192,   4096,   1024,  128,  64,   32,  8,   2}},
-    {1024,      {268435456, 33554432,  4194304,   1048576,  65536,    32768,   16384,   8192,   4096,   2048,   64,    32,   4,    1}},
-    {512,       {536870912, 33554432,  16777216,  2097152,  524288,   131072,  16384,   8192,   256,    128,    64,    32,   16,   8}},
-    {256,       {268435456, 8388608,   1048576,   262144,   65536,    16384,   8192,    4096,   512,    128,    64,    32,   16,   8,   4}},
-    {128,       {134217728, 4194304,   524288,    131072,   32768,    8192,    4096,    2048,   512,    256,    64,    32,   8,    4,   2}},
-    {64,        {67108864,  16777216,  2097152,   262144,   65536,    4096,    2048,    1024,   512,    256,    128,   32,   4,    2,   1}},
-    {32,        {536870912, 33554432,  8388608,   1048576,  131072,   32768,   2048,    1024,   512,    256,    128,   64,   2,    1}},
-    {16,        {536870912, 16777216,  1048576,   524288,   65536,    16384,   4096,    512,    256,    8,      4,     2,    1}},
-    {8,         {268435456, 8388608,   262144,    32768,    8192,     2048,    512,     256,    128,    16,     4,     2,    1}},
-    {4,         {134217728, 4194304,   131072,    16384,    4096,     1024,    256,     128,    64,     16,     8,     2,    1}},
-    {2,         {67108864,  2097152,   524288,    65536,    8192,     2048,    128,     64,     32,     16,     8,     4,    1}},
-    {1,         {33554432,  16777216,  1048576,   262144,   32768,    4096,    1024,    64,     32,     16,     8,     4,    2}},
-};
-
-static Attack_Masks BISHOP_ATTACK_MASKS = {
-    {536870912, {8388608,   131072,    2048,    32}},
-    {268435456, {16777216,  4194304,   65536,   1024}},
-    {134217728, {8388608,   2097152,   524288,  32768}},
-    {67108864,  {4194304,   1048576,   262144,  16384}},
-    {33554432,  {2097152,   131072,    8192,    512}},
-    {16777216,  {268435456, 262144,    4096,    64,      1}},
-    {8388608,   {536870912, 134217728, 524288,  131072,  2048,  32}},
-    {4194304,   {268435456, 67108864,  262144,  65536,   16384, 1024}},
-    {2097152,   {134217728, 33554432,  131072,  32768,   8192,  512}},
-    {1048576,   {67108864,  65536,     4096,    256,     16}},
-    {524288,    {134217728, 8388608,   8192,    128,     2}},
-    {262144,    {67108864,  16777216,  4194304, 16384,   4096,  64,   1}},
-    {131072,    {536870912, 33554432,  8388608, 2097152, 8192,  2048, 512, 32}},
-    {65536,     {268435456, 4194304,   1048576, 4096,    1024,  256,  16}},
-    {32768,     {134217728, 2097152,   2048,    128,     8}},
-    {16384,     {67108864,  4194304,   262144,  256,     4}},
-    {8192,      {33554432,  2097152,   524288,  131072,  512,   128,  2}},
-    {4096,      {16777216,  1048576,   262144,  65536,   256,   64,   16,  1}},
-    {2048,      {536870912, 8388608,   131072,  32768,   128,   32,   8}},
-    {1024,      {268435456, 4194304,   65536,   64,      4}},
-    {512,       {33554432,  2097152,   131072,  8192,    8}},
-    {256,       {1048576,   65536,     16384,   4096,    16,    4}},
-    {128,       {524288,    32768,     8192,    2048,    8,     2}},
-    {64,        {16777216,  262144,    4096,    1024,    4,     1}},
-    {32,        {536870912, 8388608,   131072,  2048,    2}},
-    {16,        {1048576,   65536,     4096,    256}},
-    {8,         {32768,     2048,      512,     128}},
-    {4,         {16384,     1024,      256,     64}},
-    {2,         {524288,    8192,      128,     32}},
-    {1,         {16777216,  262144,    4096,    64}},
-};
-
-static Attack_Masks KNIGHT_ATTACK_MASKS = {
-    {536870912, {4194304,   262144}},
-    {268435456, {2097152,   524288,    131072}},
-    {134217728, {16777216,  1048576,   262144,   65536}},
-    {67108864,  {8388608,   131072,    32768}},
-    {33554432,  {4194304,   65536}},
-    {16777216,  {134217728, 131072,    8192}},
-    {8388608,   {67108864,  65536,     16384,    4096}},
-    {4194304,   {536870912, 33554432,  524288,   32768,   8192,  2048}},
-    {2097152,   {268435456, 262144,    4096,     1024}},
-    {1048576,   {134217728, 131072,    2048}},
-    {524288,    {268435456, 4194304,   4096,     256}},
-    {262144,    {536870912, 134217728, 2097152,  2048,    512,   128}},
-    {131072,    {268435456, 67108864,  16777216, 1048576, 16384, 1024, 256, 64}},
-    {65536,     {134217728, 33554432,  8388608,  8192,    128,   32}},
-    {32768,     {67108864,  4194304,   4096,     64}},
-    {16384,     {8388608,   131072,    128,      8}},
-    {8192,      {16777216,  4194304,   65536,    64,      16,    4}},
-    {4096,      {8388608,   2097152,   524288,   32768,   512,   32,   8,   2}},
-    {2048,      {4194304,   1048576,   262144,   256,     4,     1}},
-    {1024,      {2097152,   131072,    128,      2}},
-    {512,       {262144,    4096,      4}},
-    {256,       {524288,    131072,    2048,     2}},
-    {128,       {262144,    65536,     16384,    1024,    16,    1}},
-    {64,        {131072,    32768,     8192,     8}},
-    {32,        {65536,     4096,      4}},
-    {16,        {8192,      128}},
-    {8,         {16384,     4096,      64}},
-    {4,         {8192,      2048,      512,      32}},
-    {2,         {4096,      1024,      256}},
-    {1,         {2048,      128}},
-};
-
-static Attack_Masks ROOK_ATTACK_MASKS = {
-    {536870912, {268435456, 134217728, 67108864,  33554432, 16777216, 524288, 16384, 512, 16}},
-    {268435456, {536870912, 134217728, 67108864,  33554432, 8388608,  262144, 8192,  256, 8}},
-    {134217728, {536870912, 268435456, 67108864,  33554432, 4194304,  131072, 4096,  128, 4}},
-    {67108864,  {536870912, 268435456, 134217728, 33554432, 2097152,  65536,  2048,  64,  2}},
-    {33554432,  {536870912, 268435456, 134217728, 67108864, 1048576,  32768,  1024,  32,  1}},
-    {16777216,  {536870912, 8388608,   4194304,   2097152,  1048576,  524288, 16384, 512, 16}},
-    {8388608,   {268435456, 16777216,  4194304,   2097152,  1048576,  262144, 8192,  256, 8}},
-    {4194304,   {134217728, 16777216,  8388608,   2097152,  1048576,  131072, 4096,  128, 4}},
-    {2097152,   {67108864,  16777216,  8388608,   4194304,  1048576,  65536,  2048,  64,  2}},
-    {1048576,   {33554432,  16777216,  8388608,   4194304,  2097152,  32768,  1024,  32,  1}},
-    {524288,    {536870912, 16777216,  262144,    131072,   65536,    32768,  16384, 512, 16}},
-    {262144,    {268435456, 8388608,   524288,    131072,   65536,    32768,  8192,  256, 8}},
-    {131072,    {134217728, 4194304,   524288,    262144,   65536,    32768,  4096,  128, 4}},
-    {65536,     {67108864,  2097152,   524288,    262144,   131072,   32768,  2048,  64,  2}},
-    {32768,     {33554432,  1048576,   524288,    262144,   131072,   65536,  1024,  32,  1}},
-    {16384,     {536870912, 16777216,  524288,    8192,     4096,     2048,   1024,  512, 16}},
-    {8192,      {268435456, 8388608,   262144,    16384,    4096,     2048,   1024,  256, 8}},
-    {4096,      {134217728, 4194304,   131072,    16384,    8192,     2048,   1024,  128, 4}},
-    {2048,      {67108864,  2097152,   65536,     16384,    8192,     4096,   1024,  64,  2}},
-    {1024,      {33554432,  1048576,   32768,     16384,    8192,     4096,   2048,  32,  1}},
-    {512,       {536870912, 16777216,  524288,    16384,    256,      128,    64,    32,  16}},
-    {256,       {268435456, 8388608,   262144,    8192,     512,      128,    64,    32,  8}},
-    {128,       {134217728, 4194304,   131072,    4096,     512,      256,    64,    32,  4}},
-    {64,        {67108864,  2097152,   65536,     2048,     512,      256,    128,   32,  2}},
-    {32,        {33554432,  1048576,   32768,     1024,     512,      256,    128,   64,  1}},
-    {16,        {536870912, 16777216,  524288,    16384,    512,      8,      4,     2,   1}},
-    {8,         {268435456, 8388608,   262144,    8192,     256,      16,     4,     2,   1}},
-    {4,         {134217728, 4194304,   131072,    4096,     128,      16,     8,     2,   1}},
-    {2,         {67108864,  2097152,   65536,     2048,     64,       16,     8,     4,   1}},
-    {1,         {33554432,  1048576,   32768,     1024,     32,       16,     8,     4,   2}},
-};
-
-static Attack_Masks BLACK_PAWN_ATTACK_MASKS = {
-    {1610612736, {268435456, 134217728, 67108864,  33554432, 16777216, 8388608, 524288,  131072, 16384,  2048,   512,   32,   16}},
-    {1342177280, {536870912, 134217728, 67108864,  33554432, 16777216, 8388608, 4194304, 262144, 65536,  8192,   1024,  256,  8}},
-    {1207959552, {536870912, 268435456, 67108864,  33554432, 8388608,  4194304, 2097152, 524288, 131072, 32768,  4096,  128,  4}},
-    {1140850688, {536870912, 268435456, 134217728, 33554432, 4194304,  2097152, 1048576, 262144, 65536,  16384,  2048,  64,   2}},
-    {1107296256, {536870912, 268435456, 134217728, 67108864, 2097152,  1048576, 131072,  32768,  8192,   1024,   512,   32,   1}},
-    {1090519040, {536870912, 268435456, 8388608,   4194304,  2097152,  1048576, 524288,  262144, 16384,  4096,   512,   64,   16,   1}},
-    {1082130432, {536870912, 268435456, 134217728, 16777216, 4194304,  2097152, 1048576, 524288, 262144, 131072, 8192,  2048, 256,  32,  8}},
-    {1077936128, {268435456, 134217728, 67108864,  16777216, 8388608,  2097152, 1048576, 262144, 131072, 65536,  16384, 4096, 1024, 128, 4}},
-    {1075838976, {134217728, 67108864,  33554432,  16777216, 8388608,  4194304, 1048576, 131072, 65536,  32768,  8192,  2048, 512,  64,  2}},
-    {1074790400, {67108864,  33554432,  16777216,  8388608,  4194304,  2097152, 65536,   32768,  4096,   1024,   256,   32,   16,   1}},
-    {1074266112, {536870912, 134217728, 16777216,  8388608,  262144,   131072,  65536,   32768,  16384,  8192,   512,   128,  16,   2}},
-    {1074003968, {268435456, 67108864,  16777216,  8388608,  4194304,  524288,  131072,  65536,  32768,  16384,  8192,  4096, 256,  64,  8,   1}},
-    {1073872896, {536870912, 134217728, 33554432,  8388608,  4194304,  2097152, 524288,  262144, 65536,  32768,  8192,  4096, 2048, 512, 128, 32, 4}},
-    {1073807360, {268435456, 67108864,  4194304,   2097152,  1048576,  524288,  262144,  131072, 32768,  4096,   2048,  1024, 256,  64,  16,  2}},
-    {1073774592, {134217728, 33554432,  2097152,   1048576,  524288,   262144,  131072,  65536,  2048,   1024,   128,   32,   8,    1}},
-    {1073758208, {536870912, 67108864,  16777216,  4194304,  524288,   262144,  8192,    4096,   2048,   1024,   512,   256,  16,   4}},
-    {1073750016, {268435456, 33554432,  8388608,   2097152,  524288,   262144,  131072,  16384,  4096,   2048,   1024,  512,  256,  128, 8,   2}},
-    {1073745920, {134217728, 16777216,  4194304,   1048576,  262144,   131072,  65536,   16384,  8192,   2048,   1024,  256,  128,  64,  16,  4,  1}},
-    {1073743872, {536870912, 67108864,  8388608,   2097152,  131072,   65536,   32768,   16384,  8192,   4096,   1024,  128,  64,   32,  8,   2}},
-    {1073742848, {268435456, 33554432,  4194304,   1048576,  65536,    32768,   16384,   8192,   4096,   2048,   64,    32,   4,    1}},
-    {1073742336, {536870912, 33554432,  16777216,  2097152,  524288,   131072,  16384,   8192,   256,    128,    64,    32,   16,   8}},
-    {1073742080, {268435456, 8388608,   1048576,   262144,   65536,    16384,   8192,    4096,   512,    128,    64,    32,   16,   8,   4}},
-    {1073741952, {134217728, 4194304,   524288,    131072,   32768,    8192,    4096,    2048,   512,    256,    64,    32,   8,    4,   2}},
-    {1073741888, {67108864,  16777216,  2097152,   262144,   65536,    4096,    2048,    1024,   512,    256,    128,   32,   4,    2,   1}},
-    {1073741856, {536870912, 33554432,  8388608,   1048576,  131072,   32768,   2048,    1024,   512,    256,    128,   64,   2,    1}},
-    {1073741840, {536870912, 16777216,  1048576,   524288,   65536,    16384,   4096,    512,    256,    8,      4,     2,    1}},
-    {1073741832, {268435456, 8388608,   262144,    32768,    8192,     2048,    512,     256,    128,    16,     4,     2,    1}},
-    {1073741828, {134217728, 4194304,   131072,    16384,    4096,     1024,    256,     128,    64,     16,     8,     2,    1}},
-    {1073741826, {67108864,  2097152,   524288,    65536,    8192,     2048,    128,     64,     32,     16,     8,     4,    1}},
-    {1073741825, {33554432,  16777216,  1048576,   262144,   32768,    4096,    1024,    64,     32,     16,     8,     4,    2}},
-    {536870912,  {8388608}},
-    {268435456,  {16777216,  4194304}},
-    {134217728,  {8388608,   2097152}},
-    {67108864,   {4194304,   1048576}},
-    {33554432,   {2097152}},
-    {16777216,   {262144}},
-    {8388608,    {524288,    131072}},
-    {4194304,    {262144,    65536}},
-    {2097152,    {131072,    32768}},
-    {1048576,    {65536}},
-    {524288,     {8192}},
-    {262144,     {16384,     4096}},
-    {131072,     {8192,      2048}},
-    {65536,      {4096,      1024}},
-    {32768,      {2048}},
-    {16384,      {256}},
-    {8192,       {512,       128}},
-    {4096,       {256,       64}},
-    {2048,       {128,       32}},
-    {1024,       {64}},
-    {512,        {8}},
-    {256,        {16,        4}},
-    {128,        {8,         2}},
-    {64,         {4,         1}},
-    {32,         {2}},
-};
-
-static Attack_Masks WHITE_PAWN_ATTACK_MASKS = {
-    {1610612736, {268435456, 134217728, 67108864,  33554432, 16777216, 8388608, 524288,  131072, 16384,  2048,   512,   32,   16}},
-    {1342177280, {536870912, 134217728, 67108864,  33554432, 16777216, 8388608, 4194304, 262144, 65536,  8192,   1024,  256,  8}},
-    {1207959552, {536870912, 268435456, 67108864,  33554432, 8388608,  4194304, 2097152, 524288, 131072, 32768,  4096,  128,  4}},
-    {1140850688, {536870912, 268435456, 134217728, 33554432, 4194304,  2097152, 1048576, 262144, 65536,  16384,  2048,  64,   2}},
-    {1107296256, {536870912, 268435456, 134217728, 67108864, 2097152,  1048576, 131072,  32768,  8192,   1024,   512,   32,   1}},
-    {1090519040, {536870912, 268435456, 8388608,   4194304,  2097152,  1048576, 524288,  262144, 16384,  4096,   512,   64,   16,   1}},
-    {1082130432, {536870912, 268435456, 134217728, 16777216, 4194304,  2097152, 1048576, 524288, 262144, 131072, 8192,  2048, 256,  32,  8}},
-    {1077936128, {268435456, 134217728, 67108864,  16777216, 8388608,  2097152, 1048576, 262144, 131072, 65536,  16384, 4096, 1024, 128, 4}},
-    {1075838976, {134217728, 67108864,  33554432,  16777216, 8388608,  4194304, 1048576, 131072, 65536,  32768,  8192,  2048, 512,  64,  2}},
-    {1074790400, {67108864,  33554432,  16777216,  8388608,  4194304,  2097152, 65536,   32768,  4096,   1024,   256,   32,   16,   1}},
-    {1074266112, {536870912, 134217728, 16777216,  8388608,  262144,   131072,  65536,   32768,  16384,  8192,   512,   128,  16,   2}},
-    {1074003968, {268435456, 67108864,  16777216,  8388608,  4194304,  524288,  131072,  65536,  32768,  16384,  8192,  4096, 256,  64,  8,   1}},
-    {1073872896, {536870912, 134217728, 33554432,  8388608,  4194304,  2097152, 524288,  262144, 65536,  32768,  8192,  4096, 2048, 512, 128, 32, 4}},
-    {1073807360, {268435456, 67108864,  4194304,   2097152,  1048576,  524288,  262144,  131072, 32768,  4096,   2048,  1024, 256,  64,  16,  2}},
-    {1073774592, {134217728, 33554432,  2097152,   1048576,  524288,   262144,  131072,  65536,  2048,   1024,   128,   32,   8,    1}},
-    {1073758208, {536870912, 67108864,  16777216,  4194304,  524288,   262144,  8192,    4096,   2048,   1024,   512,   256,  16,   4}},
-    {1073750016, {268435456, 33554432,  8388608,   2097152,  524288,   262144,  131072,  16384,  4096,   2048,   1024,  512,  256,  128, 8,   2}},
-    {1073745920, {134217728, 16777216,  4194304,   1048576,  262144,   131072,  65536,   16384,  8192,   2048,   1024,  256,  128,  64,  16,  4,  1}},
-    {1073743872, {536870912, 67108864,  8388608,   2097152,  131072,   65536,   32768,   16384,  8192,   4096,   1024,  128,  64,   32,  8,   2}},
-    {1073742848, {268435456, 33554432,  4194304,   1048576,  65536,    32768,   16384,   8192,   4096,   2048,   64,    32,   4,    1}},
-    {1073742336, {536870912, 33554432,  16777216,  2097152,  524288,   131072,  16384,   8192,   256,    128,    64,    32,   16,   8}},
-    {1073742080, {268435456, 8388608,   1048576,   262144,   65536,    16384,   8192,    4096,   512,    128,    64,    32,   16,   8,   4}},
-    {1073741952, {134217728, 4194304,   524288,    131072,   32768,    8192,    4096,    2048,   512,    256,    64,    32,   8,    4,   2}},
-    {1073741888, {67108864,  16777216,  2097152,   262144,   65536,    4096,    2048,    1024,   512,    256,    128,   32,   4,    2,   1}},
-    {1073741856, {536870912, 33554432,  8388608,   1048576,  131072,   32768,   2048,    1024,   512,    256,    128,   64,   2,    1}},
-    {1073741840, {536870912, 16777216,  1048576,   524288,   65536,    16384,   4096,    512,    256,    8,      4,     2,    1}},
-    {1073741832, {268435456, 8388608,   262144,    32768,    8192,     2048,    512,     256,    128,    16,     4,     2,    1}},
-    {1073741828, {134217728, 4194304,   131072,    16384,    4096,     1024,    256,     128,    64,     16,     8,     2,    1}},
-    {1073741826, {67108864,  2097152,   524288,    65536,    8192,     2048,    128,     64,     32,     16,     8,     4,    1}},
-    {1073741825, {33554432,  16777216,  1048576,   262144,   32768,    4096,    1024,    64,     32,     16,     8,     4,    2}},
-    {16777216,   {268435456}},
-    {8388608,    {536870912, 134217728}},
-    {4194304,    {268435456, 67108864}},
-    {2097152,    {134217728, 33554432}},
-    {1048576,    {67108864}},
-    {524288,     {8388608}},
-    {262144,     {16777216,  4194304}},
-    {131072,     {8388608,   2097152}},
-    {65536,      {4194304,   1048576}},
-    {32768,      {2097152}},
-    {16384,      {262144}},
-    {8192,       {524288,    131072}},
-    {4096,       {262144,    65536}},
-    {2048,       {131072,    32768}},
-    {1024,       {65536}},
-    {512,        {8192}},
-    {256,        {16384,     4096}},
-    {128,        {8192,      2048}},
-    {64,         {4096,      1024}},
-    {32,         {2048}},
-    {16,         {256}},
-    {8,          {512,       128}},
-    {4,          {256,       64}},
-    {2,          {128,       32}},
-    {1,          {64}},
-};
-
-static std::unordered_map<unsigned int, unsigned int> KING_ATTACK_MASKS_COMBINED = {
-    {536870912, 830472192},
-    {268435456, 968884224},
-    {134217728, 484442112},
-    {67108864,  242221056},
-    {33554432,  103809024},
-    {16777216,  831258624},
-    {8388608,   969801728},
-    {4194304,   484900864},
-    {2097152,   242450432},
-    {1048576,   103907328},
-    {524288,    25976832},
-    {262144,    30306304},
-    {131072,    15153152},
-    {65536,     7576576},
-    {32768,     3247104},
-    {16384,     811776},
-    {8192,      947072},
-    {4096,      473536},
-    {2048,      236768},
-    {1024,      101472},
-    {512,       25368},
-    {256,       29596},
-    {128,       14798},
-    {64,        7399},
-    {32,        3171},
-    {16,        792},
-    {8,         924},
-    {4,         462},
-    {2,         231},
-    {1,         99},
-};
-
-static std::unordered_map<unsigned int, unsigned int> QUEEN_ATTACK_MASKS_COMBINED = {
-    {536870912, 1066027568},
-    {268435456, 1069884680},
-    {134217728, 1055559812},
-    {67108864,  1047873602},
-    {33554432,  1043506721},
-    {16777216,  838619729},
-    {8388608,   972957992},
-    {4194304,   502748292},
-    {2097152,   267627074},
-    {1048576,   133272881},
-    {524288,    697295506},
-    {262144,    365949257},
-    {131072,    720353956},
-    {65536,     343907666},
-    {32768,     171936937},
-    {16384,     625770260},
-    {8192,      313425802},
-    {4096,      156728789},
-    {2048,      614726890},
-    {1024,      307362917},
-    {512,       589980664},
-    {256,       278230012},
-    {128,       139115502},
-    {64,        86319079},
-    {32,        580030435},
-    {16,        555307807},
-    {8,         277130143},
-    {4,         138565087},
-    {2,         69806335},
-    {1,         51680383},
-};
-
-static std::unordered_map<unsigned int, unsigned int> BISHOP_ATTACK_MASKS_COMBINED = {
-    {536870912, 545392672},
-    {268435456, 289473536},
-    {134217728, 145260544},
-    {67108864,  72630272},
-    {33554432,  35791360},
-    {16777216,  285478977},
-    {8388608,   680134688},
-    {4194304,   340083712},
-    {2097152,   170041856},
-    {1048576,   68227344},
-    {524288,    143138946},
-    {262144,    88363073},
-    {131072,    581052960},
-    {65536,     273749264},
-    {32768,     136349832},
-    {16384,     71581956},
-    {8192,      36315778},
-    {4096,      18157905},
-    {2048,      545425576},
-    {1024,      272696388},
-    {512,       35791368},
-    {256,       1134868},
-    {128,       567434},
-    {64,        17044549},
-    {32,        545392674},
-    {16,        1118480},
-    {8,         35464},
-    {4,         17732},
-    {2,         532642},
-    {1,         17043521},
-};
-
-static std::unordered_map<unsigned int, unsigned int> KNIGHT_ATTACK_MASKS_COMBINED = {
-    {536870912, 541327360},
-    {268435456, 271187968},
-    {134217728, 152371200},
-    {67108864,  75661312},
-    {33554432,  37814272},
-    {16777216,  151134208},
-    {8388608,   75583488},
-    {4194304,   575186944},
-    {2097152,   270799872},
-    {1048576,   135399424},
-    {524288,    273158400},
-    {262144,    673450624},
-    {131072,    353518912},
-    {65536,     176234656},
-    {32768,     71340096},
-    {16384,     8536200},
-    {8192,      21045332},
-    {4096,      11047466},
-    {2048,      5507333},
-    {1024,      2229378},
-    {512,       266756},
-    {256,       657666},
-    {128,       345233},
-    {64,        172104},
-    {32,        69668},
-    {16,        8336},
-    {8,         20552},
-    {4,         10788},
-    {2,         5378},
-    {1,         2177},
-};
-
-static std::unordered_map<unsigned int, unsigned int> ROOK_ATTACK_MASKS_COMBINED = {
-    {536870912, 1057505808},
-    {268435456, 1048846600},
-    {134217728, 1044516996},
-    {67108864,  1042352194},
-    {33554432,  1041269793},
-    {16777216,  569917968},
-    {8388608,   301211912},
-    {4194304,   166858884},
-    {2097152,   99682370},
-    {1048576,   66094113},
-    {524288,    554680848},
-    {262144,    277848328},
-    {131072,    139432068},
-    {65536,     70223938},
-    {32768,     35619873},
-    {16384,     554204688},
-    {8192,      277118216},
-    {4096,      138574980},
-    {2048,      69303362},
-    {1024,      34667553},
-    {512,       554189808},
-    {256,       277095400},
-    {128,       138548196},
-    {64,        69274594},
-    {32,        34637793},
-    {16,        554189343},
-    {8,         277094687},
-    {4,         138547359},
-    {2,         69273695},
-    {1,         34636863},
-};
-
-static std::unordered_map<unsigned int, unsigned int> BLACK_PAWN_ATTACK_MASKS_COMBINED = {
-    {536870912, 545259520},
-    {268435456, 289406976},
-    {134217728, 144703488},
-    {67108864,  72351744},
-    {33554432,  35651584},
-    {16777216,  17039360},
-    {8388608,   9043968},
-    {4194304,   4521984},
-    {2097152,   2260992},
-    {1048576,   1114112},
-    {524288,    532480},
-    {262144,    282624},
-    {131072,    141312},
-    {65536,     70656},
-    {32768,     34816},
-    {16384,     16640},
-    {8192,      8832},
-    {4096,      4416},
-    {2048,      2208},
-    {1024,      1088},
-    {512,       520},
-    {256,       276},
-    {128,       138},
-    {64,        69},
-    {32,        34},
-    {16,        16},
-    {8,         8},
-    {4,         4},
-    {2,         2},
-    {1,         1},
-};
-
-static std::unordered_map<unsigned int, unsigned int> WHITE_PAWN_ATTACK_MASKS_COMBINED = {
-    {536870912, 536870912},
-    {268435456, 268435456},
-    {134217728, 134217728},
-    {67108864,  67108864},
-    {33554432,  33554432},
-    {16777216,  285212672},
-    {8388608,   679477248},
-    {4194304,   339738624},
-    {2097152,   169869312},
-    {1048576,   68157440},
-    {524288,    8912896},
-    {262144,    21233664},
-    {131072,    10616832},
-    {65536,     5308416},
-    {32768,     2129920},
-    {16384,     278528},
-    {8192,      663552},
-    {4096,      331776},
-    {2048,      165888},
-    {1024,      66560},
-    {512,       8704},
-    {256,       20736},
-    {128,       10368},
-    {64,        5184},
-    {32,        2080},
-    {16,        272},
-    {8,         648},
-    {4,         324},
-    {2,         162},
-    {1,         65},
-};
-
-static Move_Masks KING_MOVE_MASKS = {
-    {536870912, {268435456, 16777216,  8388608}},
-    {268435456, {536870912, 134217728, 16777216,  8388608,  4194304}},
-    {134217728, {268435456, 67108864,  8388608,   4194304,  2097152}},
-    {67108864,  {134217728, 33554432,  4194304,   2097152,  1048576}},
-    {33554432,  {67108864,  2097152,   1048576}},
-    {16777216,  {536870912, 268435456, 8388608,   524288,   262144}},
-    {8388608,   {536870912, 268435456, 134217728, 16777216, 4194304, 524288, 262144, 131072}},
-    {4194304,   {268435456, 134217728, 67108864,  8388608,  2097152, 262144, 131072, 65536}},
-    {2097152,   {134217728, 67108864,  33554432,  4194304,  1048576, 131072, 65536,  32768}},
-    {1048576,   {67108864,  33554432,  2097152,   65536,    32768}},
-    {524288,    {16777216,  8388608,   262144,    16384,    8192}},
-    {262144,    {16777216,  8388608,   4194304,   524288,   131072,  16384,  8192,   4096}},
-    {131072,    {8388608,   4194304,   2097152,   262144,   65536,   8192,   4096,   2048}},
-    {65536,     {4194304,   2097152,   1048576,   131072,   32768,   4096,   2048,   1024}},
-    {32768,     {2097152,   1048576,   65536,     2048,     1024}},
-    {16384,     {524288,    262144,    8192,      512,      256}},
-    {8192,      {524288,    262144,    131072,    16384,    4096,    512,    256,    128}},
-    {4096,      {262144,    131072,    65536,     8192,     2048,    256,    128,    64}},
-    {2048,      {131072,    65536,     32768,     4096,     1024,    128,    64,     32}},
-    {1024,      {65536,     32768,     2048,      64,       32}},
-    {512,       {16384,     8192,      256,       16,       8}},
-    {256,       {16384,     8192,      4096,      512,      128,     16,     8,      4}},
-    {128,       {8192,      4096,      2048,      256,      64,      8,      4,      2}},
-    {64,        {4096,      2048,      1024,      128,      32,      4,      2,      1}},
-    {32,        {2048,      1024,      64,        2,        1}},
-    {16,        {512,       256,       8}},
-    {8,         {512,       256,       128,       16,       4}},
-    {4,         {256,       128,       64,        8,        2}},
-    {2,         {128,       64,        32,        4,        1}},
-    {1,         {64,        32,        2}},
-};
-
-static Move_Masks QUEEN_MOVE_MASKS = {
-    {536870912, {268435456, 134217728, 67108864,  33554432, 16777216, 8388608, 524288,  131072, 16384,  2048,   512,   32,   16}},
-    {268435456, {536870912, 134217728, 67108864,  33554432, 16777216, 8388608, 4194304, 262144, 65536,  8192,   1024,  256,  8}},
-    {134217728, {536870912, 268435456, 67108864,  33554432, 8388608,  4194304, 2097152, 524288, 131072, 32768,  4096,  128,  4}},
-    {67108864,  {536870912, 268435456, 134217728, 33554432, 4194304,  2097152, 1048576, 262144, 65536,  16384,  2048,  64,   2}},
-    {33554432,  {536870912, 268435456, 134217728, 67108864, 2097152,  1048576, 131072,  32768,  8192,   1024,   512,   32,   1}},
-    {16777216,  {536870912, 268435456, 8388608,   4194304,  2097152,  1048576, 524288,  262144, 16384,  4096,   512,   64,   16,   1}},
-    {8388608,   {536870912, 268435456, 134217728, 16777216, 4194304,  2097152, 1048576, 524288, 262144, 131072, 8192,  2048, 256,  32,  8}},
-    {4194304,   {268435456, 134217728, 67108864,  16777216, 8388608,  2097152, 1048576, 262144, 131072, 65536,  16384, 4096, 1024, 128, 4}},
-    {2097152,   {134217728, 67108864,  33554432,  16777216, 8388608,  4194304, 1048576, 131072, 65536,  32768,  8192,  2048, 512,  64,  2}},
-    {1048576,   {67108864,  33554432,  16777216,  8388608,  4194304,  2097152, 65536,   32768,  4096,   1024,   256,   32,   16,   1}},
-    {524288,    {536870912, 134217728, 16777216,  8388608,  262144,   131072,  65536,   32768,  16384,  8192,   512,   128,  16,   2}},
-    {262144,    {268435456, 67108864,  16777216,  8388608,  4194304,  524288,  131072,  65536,  32768,  16384,  8192,  4096, 256,  64,  8,   1}},
-    {131072,    {536870912, 134217728, 33554432,  8388608,  4194304,  2097152, 524288,  262144, 65536,  32768,  8192,  4096, 2048, 512, 128, 32, 4}},
-    {65536,     {268435456, 67108864,  4194304,   2097152,  1048576,  524288,  262144,  131072, 32768,  4096,   2048,  1024, 256,  64,  16,  2}},
-    {32768,     {134217728, 33554432,  2097152,   1048576,  524288,   262144,  131072,  65536,  2048,   1024,   128,   32,   8,    1}},
-    {16384,     {536870912, 67108864,  16777216,  4194304,  524288,   262144,  8192,    4096,   2048,   1024,   512,   256,  16,   4}},
-    {8192,      {268435456, 33554432,  8388608,   2097152,  524288,   262144,  131072,  16384,  4096,   2048,   1024,  512,  256,  128, 8,   2}},
-    {4096,      {134217728, 16777216,  4194304,   1048576,  262144,   131072,  65536,   16384,  8192,   2048,   1024,  256,  128,  64,  16,  4,  1}},
-    {2048,      {536870912, 67108864,  8388608,   2097152,  131072,   65536,   32768,   16384,  8192,   4096,   1024,  128,  64,   32,  8,   2}},
-    {1024,      {268435456, 33554432,  4194304,   1048576,  65536,    32768,   16384,   8192,   4096,   2048,   64,    32,   4,    1}},
-    {512,       {536870912, 33554432,  16777216,  2097152,  524288,   131072,  16384,   8192,   256,    128,    64,    32,   16,   8}},
-    {256,       {268435456, 8388608,   1048576,   262144,   65536,    16384,   8192,    4096,   512,    128,    64,    32,   16,   8,   4}},
-    {128,       {134217728, 4194304,   524288,    131072,   32768,    8192,    4096,    2048,   512,    256,    64,    32,   8,    4,   2}},
-    {64,        {67108864,  16777216,  2097152,   262144,   65536,    4096,    2048,    1024,   512,    256,    128,   32,   4,    2,   1}},
-    {32,        {536870912, 33554432,  8388608,   1048576,  131072,   32768,   2048,    1024,   512,    256,    128,   64,   2,    1}},
-    {16,        {536870912, 16777216,  1048576,   524288,   65536,    16384,   4096,    512,    256,    8,      4,     2,    1}},
-    {8,         {268435456, 8388608,   262144,    32768,    8192,     2048,    512,     256,    128,    16,     4,     2,    1}},
-    {4,         {134217728, 4194304,   131072,    16384,    4096,     1024,    256,     128,    64,     16,     8,     2,    1}},
-    {2,         {67108864,  2097152,   524288,    65536,    8192,     2048,    128,     64,     32,     16,     8,     4,    1}},
-    {1,         {33554432,  16777216,  1048576,   262144,   32768,    4096,    1024,    64,     32,     16,     8,     4,    2}},
-};
-
-static Move_Masks BISHOP_MOVE_MASKS = {
-    {536870912, {268435456, 16777216,  8388608,   131072,   2048,    32}},
-    {268435456, {536870912, 134217728, 16777216,  8388608,  4194304, 65536,  1024}},
-    {134217728, {268435456, 67108864,  8388608,   4194304,  2097152, 524288, 32768}},
-    {67108864,  {134217728, 33554432,  4194304,   2097152,  1048576, 262144, 16384}},
-    {33554432,  {67108864,  2097152,   1048576,   131072,   8192,    512}},
-    {16777216,  {536870912, 268435456, 8388608,   524288,   262144,  4096,   64,     1}},
-    {8388608,   {536870912, 268435456, 134217728, 16777216, 4194304, 524288, 262144, 131072, 2048,  32}},
-    {4194304,   {268435456, 134217728, 67108864,  8388608,  2097152, 262144, 131072, 65536,  16384, 1024}},
-    {2097152,   {134217728, 67108864,  33554432,  4194304,  1048576, 131072, 65536,  32768,  8192,  512}},
-    {1048576,   {67108864,  33554432,  2097152,   65536,    32768,   4096,   256,    16}},
-    {524288,    {134217728, 16777216,  8388608,   262144,   16384,   8192,   128,    2}},
-    {262144,    {67108864,  16777216,  8388608,   4194304,  524288,  131072, 16384,  8192,   4096,  64,   1}},
-    {131072,    {536870912, 33554432,  8388608,   4194304,  2097152, 262144, 65536,  8192,   4096,  2048, 512, 32}},
-    {65536,     {268435456, 4194304,   2097152,   1048576,  131072,  32768,  4096,   2048,   1024,  256,  16}},
-    {32768,     {134217728, 2097152,   1048576,   65536,    2048,    1024,   128,    8}},
-    {16384,     {67108864,  4194304,   524288,    262144,   8192,    512,    256,    4}},
-    {8192,      {33554432,  2097152,   524288,    262144,   131072,  16384,  4096,   512,    256,   128,  2}},
-    {4096,      {16777216,  1048576,   262144,    131072,   65536,   8192,   2048,   256,    128,   64,   16,  1}},
-    {2048,      {536870912, 8388608,   131072,    65536,    32768,   4096,   1024,   128,    64,    32,   8}},
-    {1024,      {268435456, 4194304,   65536,     32768,    2048,    64,     32,     4}},
-    {512,       {33554432,  2097152,   131072,    16384,    8192,    256,    16,     8}},
-    {256,       {1048576,   65536,     16384,     8192,     4096,    512,    128,    16,     8,     4}},
-    {128,       {524288,    32768,     8192,      4096,     2048,    256,    64,     8,      4,     2}},
-    {64,        {16777216,  262144,    4096,      2048,     1024,    128,    32,     4,      2,     1}},
-    {32,        {536870912, 8388608,   131072,    2048,     1024,    64,     2,      1}},
-    {16,        {1048576,   65536,     4096,      512,      256,     8}},
-    {8,         {32768,     2048,      512,       256,      128,     16,     4}},
-    {4,         {16384,     1024,      256,       128,      64,      8,      2}},
-    {2,         {524288,    8192,      128,       64,       32,      4,      1}},
-    {1,         {16777216,  262144,    4096,      64,       32,      2}},
-};
-
-static Move_Masks KNIGHT_MOVE_MASKS = {
-    {536870912, {4194304,   262144}},
-    {268435456, {2097152,   524288,    131072}},
-    {134217728, {16777216,  1048576,   262144,   65536}},
-    {67108864,  {8388608,   131072,    32768}},
-    {33554432,  {4194304,   65536}},
-    {16777216,  {134217728, 131072,    8192}},
-    {8388608,   {67108864,  65536,     16384,    4096}},
-    {4194304,   {536870912, 33554432,  524288,   32768,   8192,  2048}},
-    {2097152,   {268435456, 262144,    4096,     1024}},
-    {1048576,   {134217728, 131072,    2048}},
-    {524288,    {268435456, 4194304,   4096,     256}},
-    {262144,    {536870912, 134217728, 2097152,  2048,    512,   128}},
-    {131072,    {268435456, 67108864,  16777216, 1048576, 16384, 1024, 256, 64}},
-    {65536,     {134217728, 33554432,  8388608,  8192,    128,   32}},
-    {32768,     {67108864,  4194304,   4096,     64}},
-    {16384,     {8388608,   131072,    128,      8}},
-    {8192,      {16777216,  4194304,   65536,    64,      16,    4}},
-    {4096,      {8388608,   2097152,   524288,   32768,   512,   32,   8,   2}},
-    {2048,      {4194304,   1048576,   262144,   256,     4,     1}},
-    {1024,      {2097152,   131072,    128,      2}},
-    {512,       {262144,    4096,      4}},
-    {256,       {524288,    131072,    2048,     2}},
-    {128,       {262144,    65536,     16384,    1024,    16,    1}},
-    {64,        {131072,    32768,     8192,     8}},
-    {32,        {65536,     4096,      4}},
-    {16,        {8192,      128}},
-    {8,         {16384,     4096,      64}},
-    {4,         {8192,      2048,      512,      32}},
-    {2,         {4096,      1024,      256}},
-    {1,         {2048,      128}},
-};
-
-static Move_Masks ROOK_MOVE_MASKS = {
-    {536870912, {268435456, 134217728, 67108864,  33554432, 16777216, 524288, 16384, 512, 16}},
-    {268435456, {536870912, 134217728, 67108864,  33554432, 8388608,  262144, 8192,  256, 8}},
-    {134217728, {536870912, 268435456, 67108864,  33554432, 4194304,  131072, 4096,  128, 4}},
-    {67108864,  {536870912, 268435456, 134217728, 33554432, 2097152,  65536,  2048,  64,  2}},
-    {33554432,  {536870912, 268435456, 134217728, 67108864, 1048576,  32768,  1024,  32,  1}},
-    {16777216,  {536870912, 8388608,   4194304,   2097152,  1048576,  524288, 16384, 512, 16}},
-    {8388608,   {268435456, 16777216,  4194304,   2097152,  1048576,  262144, 8192,  256, 8}},
-    {4194304,   {134217728, 16777216,  8388608,   2097152,  1048576,  131072, 4096,  128, 4}},
-    {2097152,   {67108864,  16777216,  8388608,   4194304,  1048576,  65536,  2048,  64,  2}},
-    {1048576,   {33554432,  16777216,  8388608,   4194304,  2097152,  32768,  1024,  32,  1}},
-    {524288,    {536870912, 16777216,  262144,    131072,   65536,    32768,  16384, 512, 16}},
-    {262144,    {268435456, 8388608,   524288,    131072,   65536,    32768,  8192,  256, 8}},
-    {131072,    {134217728, 4194304,   524288,    262144,   65536,    32768,  4096,  128, 4}},
-    {65536,     {67108864,  2097152,   524288,    262144,   131072,   32768,  2048,  64,  2}},
-    {32768,     {33554432,  1048576,   524288,    262144,   131072,   65536,  1024,  32,  1}},
-    {16384,     {536870912, 16777216,  524288,    8192,     4096,     2048,   1024,  512, 16}},
-    {8192,      {268435456, 8388608,   262144,    16384,    4096,     2048,   1024,  256, 8}},
-    {4096,      {134217728, 4194304,   131072,    16384,    8192,     2048,   1024,  128, 4}},
-    {2048,      {67108864,  2097152,   65536,     16384,    8192,     4096,   1024,  64,  2}},
-    {1024,      {33554432,  1048576,   32768,     16384,    8192,     4096,   2048,  32,  1}},
-    {512,       {536870912, 16777216,  524288,    16384,    256,      128,    64,    32,  16}},
-    {256,       {268435456, 8388608,   262144,    8192,     512,      128,    64,    32,  8}},
-    {128,       {134217728, 4194304,   131072,    4096,     512,      256,    64,    32,  4}},
-    {64,        {67108864,  2097152,   65536,     2048,     512,      256,    128,   32,  2}},
-    {32,        {33554432,  1048576,   32768,     1024,     512,      256,    128,   64,  1}},
-    {16,        {536870912, 16777216,  524288,    16384,    512,      8,      4,     2,   1}},
-    {8,         {268435456, 8388608,   262144,    8192,     256,      16,     4,     2,   1}},
-    {4,         {134217728, 4194304,   131072,    4096,     128,      16,     8,     2,   1}},
-    {2,         {67108864,  2097152,   65536,     2048,     64,       16,     8,     4,   1}},
-    {1,         {33554432,  1048576,   32768,     1024,     32,       16,     8,     4,   2}},
-};
-
-static Move_Masks BLACK_PAWN_MOVE_MASKS = {
-    {1610612736, {268435456, 134217728, 67108864,  33554432, 16777216, 8388608, 524288,  131072, 16384,  2048,   512,   32,   16}},
-    {1342177280, {536870912, 134217728, 67108864,  33554432, 16777216, 8388608, 4194304, 262144, 65536,  8192,   1024,  256,  8}},
-    {1207959552, {536870912, 268435456, 67108864,  33554432, 8388608,  4194304, 2097152, 524288, 131072, 32768,  4096,  128,  4}},
-    {1140850688, {536870912, 268435456, 134217728, 33554432, 4194304,  2097152, 1048576, 262144, 65536,  16384,  2048,  64,   2}},
-    {1107296256, {536870912, 268435456, 134217728, 67108864, 2097152,  1048576, 131072,  32768,  8192,   1024,   512,   32,   1}},
-    {1090519040, {536870912, 268435456, 8388608,   4194304,  2097152,  1048576, 524288,  262144, 16384,  4096,   512,   64,   16,   1}},
-    {1082130432, {536870912, 268435456, 134217728, 16777216, 4194304,  2097152, 1048576, 524288, 262144, 131072, 8192,  2048, 256,  32,  8}},
-    {1077936128, {268435456, 134217728, 67108864,  16777216, 8388608,  2097152, 1048576, 262144, 131072, 65536,  16384, 4096, 1024, 128, 4}},
-    {1075838976, {134217728, 67108864,  33554432,  16777216, 8388608,  4194304, 1048576, 131072, 65536,  32768,  8192,  2048, 512,  64,  2}},
-    {1074790400, {67108864,  33554432,  16777216,  8388608,  4194304,  2097152, 65536,   32768,  4096,   1024,   256,   32,   16,   1}},
-    {1074266112, {536870912, 134217728, 16777216,  8388608,  262144,   131072,  65536,   32768,  16384,  8192,   512,   128,  16,   2}},
-    {1074003968, {268435456, 67108864,  16777216,  8388608,  4194304,  524288,  131072,  65536,  32768,  16384,  8192,  4096, 256,  64,  8,   1}},
-    {1073872896, {536870912, 134217728, 33554432,  8388608,  4194304,  2097152, 524288,  262144, 65536,  32768,  8192,  4096, 2048, 512, 128, 32, 4}},
-    {1073807360, {268435456, 67108864,  4194304,   2097152,  1048576,  524288,  262144,  131072, 32768,  4096,   2048,  1024, 256,  64,  16,  2}},
-    {1073774592, {134217728, 33554432,  2097152,   1048576,  524288,   262144,  131072,  65536,  2048,   1024,   128,   32,   8,    1}},
-    {1073758208, {536870912, 67108864,  16777216,  4194304,  524288,   262144,  8192,    4096,   2048,   1024,   512,   256,  16,   4}},
-    {1073750016, {268435456, 33554432,  8388608,   2097152,  524288,   262144,  131072,  16384,  4096,   2048,   1024,  512,  256,  128, 8,   2}},
-    {1073745920, {134217728, 16777216,  4194304,   1048576,  262144,   131072,  65536,   16384,  8192,   2048,   1024,  256,  128,  64,  16,  4,  1}},
-    {1073743872, {536870912, 67108864,  8388608,   2097152,  131072,   65536,   32768,   16384,  8192,   4096,   1024,  128,  64,   32,  8,   2}},
-    {1073742848, {268435456, 33554432,  4194304,   1048576,  65536,    32768,   16384,   8192,   4096,   2048,   64,    32,   4,    1}},
-    {1073742336, {536870912, 33554432,  16777216,  2097152,  524288,   131072,  16384,   8192,   256,    128,    64,    32,   16,   8}},
-    {1073742080, {268435456, 8388608,   1048576,   262144,   65536,    16384,   8192,    4096,   512,    128,    64,    32,   16,   8,   4}},
-    {1073741952, {134217728, 4194304,   524288,    131072,   32768,    8192,    4096,    2048,   512,    256,    64,    32,   8,    4,   2}},
-    {1073741888, {67108864,  16777216,  2097152,   262144,   65536,    4096,    2048,    1024,   512,    256,    128,   32,   4,    2,   1}},
-    {1073741856, {536870912, 33554432,  8388608,   1048576,  131072,   32768,   2048,    1024,   512,    256,    128,   64,   2,    1}},
-    {1073741840, {536870912, 16777216,  1048576,   524288,   65536,    16384,   4096,    512,    256,    8,      4,     2,    1}},
-    {1073741832, {268435456, 8388608,   262144,    32768,    8192,     2048,    512,     256,    128,    16,     4,     2,    1}},
-    {1073741828, {134217728, 4194304,   131072,    16384,    4096,     1024,    256,     128,    64,     16,     8,     2,    1}},
-    {1073741826, {67108864,  2097152,   524288,    65536,    8192,     2048,    128,     64,     32,     16,     8,     4,    1}},
-    {1073741825, {33554432,  16777216,  1048576,   262144,   32768,    4096,    1024,    64,     32,     16,     8,     4,    2}},
-    {536870912,  {16777216}},
-    {268435456,  {8388608}},
-    {134217728,  {4194304}},
-    {67108864,   {2097152}},
-    {33554432,   {1048576}},
-    {16777216,   {524288}},
-    {8388608,    {262144}},
-    {4194304,    {131072}},
-    {2097152,    {65536}},
-    {1048576,    {32768}},
-    {524288,     {16384}},
-    {262144,     {8192}},
-    {131072,     {4096}},
-    {65536,      {2048}},
-    {32768,      {1024}},
-    {16384,      {512}},
-    {8192,       {256}},
-    {4096,       {128}},
-    {2048,       {64}},
-    {1024,       {32}},
-    {512,        {16}},
-    {256,        {8}},
-    {128,        {4}},
-    {64,         {2}},
-    {32,         {1}},
-};
-
-static Move_Masks WHITE_PAWN_MOVE_MASKS = {
-    {1610612736, {268435456, 134217728, 67108864,  33554432, 16777216, 8388608, 524288,  131072, 16384,  2048,   512,   32,   16}},
-    {1342177280, {536870912, 134217728, 67108864,  33554432, 16777216, 8388608, 4194304, 262144, 65536,  8192,   1024,  256,  8}},
-    {1207959552, {536870912, 268435456, 67108864,  33554432, 8388608,  4194304, 2097152, 524288, 131072, 32768,  4096,  128,  4}},
-    {1140850688, {536870912, 268435456, 134217728, 33554432, 4194304,  2097152, 1048576, 262144, 65536,  16384,  2048,  64,   2}},
-    {1107296256, {536870912, 268435456, 134217728, 67108864, 2097152,  1048576, 131072,  32768,  8192,   1024,   512,   32,   1}},
-    {1090519040, {536870912, 268435456, 8388608,   4194304,  2097152,  1048576, 524288,  262144, 16384,  4096,   512,   64,   16,   1}},
-    {1082130432, {536870912, 268435456, 134217728, 16777216, 4194304,  2097152, 1048576, 524288, 262144, 131072, 8192,  2048, 256,  32,  8}},
-    {1077936128, {268435456, 134217728, 67108864,  16777216, 8388608,  2097152, 1048576, 262144, 131072, 65536,  16384, 4096, 1024, 128, 4}},
-    {1075838976, {134217728, 67108864,  33554432,  16777216, 8388608,  4194304, 1048576, 131072, 65536,  32768,  8192,  2048, 512,  64,  2}},
-    {1074790400, {67108864,  33554432,  16777216,  8388608,  4194304,  2097152, 65536,   32768,  4096,   1024,   256,   32,   16,   1}},
-    {1074266112, {536870912, 134217728, 16777216,  8388608,  262144,   131072,  65536,   32768,  16384,  8192,   512,   128,  16,   2}},
-    {1074003968, {268435456, 67108864,  16777216,  8388608,  4194304,  524288,  131072,  65536,  32768,  16384,  8192,  4096, 256,  64,  8,   1}},
-    {1073872896, {536870912, 134217728, 33554432,  8388608,  4194304,  2097152, 524288,  262144, 65536,  32768,  8192,  4096, 2048, 512, 128, 32, 4}},
-    {1073807360, {268435456, 67108864,  4194304,   2097152,  1048576,  524288,  262144,  131072, 32768,  4096,   2048,  1024, 256,  64,  16,  2}},
-    {1073774592, {134217728, 33554432,  2097152,   1048576,  524288,   262144,  131072,  65536,  2048,   1024,   128,   32,   8,    1}},
-    {1073758208, {536870912, 67108864,  16777216,  4194304,  524288,   262144,  8192,    4096,   2048,   1024,   512,   256,  16,   4}},
-    {1073750016, {268435456, 33554432,  8388608,   2097152,  524288,   262144,  131072,  16384,  4096,   2048,   1024,  512,  256,  128, 8,   2}},
-    {1073745920, {134217728, 16777216,  4194304,   1048576,  262144,   131072,  65536,   16384,  8192,   2048,   1024,  256,  128,  64,  16,  4,  1}},
-    {1073743872, {536870912, 67108864,  8388608,   2097152,  131072,   65536,   32768,   16384,  8192,   4096,   1024,  128,  64,   32,  8,   2}},
-    {1073742848, {268435456, 33554432,  4194304,   1048576,  65536,    32768,   16384,   8192,   4096,   2048,   64,    32,   4,    1}},
-    {1073742336, {536870912, 33554432,  16777216,  2097152,  524288,   131072,  16384,   8192,   256,    128,    64,    32,   16,   8}},
-    {1073742080, {268435456, 8388608,   1048576,   262144,   65536,    16384,   8192,    4096,   512,    128,    64,    32,   16,   8,   4}},
-    {1073741952, {134217728, 4194304,   524288,    131072,   32768,    8192,    4096,    2048,   512,    256,    64,    32,   8,    4,   2}},
-    {1073741888, {67108864,  16777216,  2097152,   262144,   65536,    4096,    2048,    1024,   512,    256,    128,   32,   4,    2,   1}},
-    {1073741856, {536870912, 33554432,  8388608,   1048576,  131072,   32768,   2048,    1024,   512,    256,    128,   64,   2,    1}},
-    {1073741840, {536870912, 16777216,  1048576,   524288,   65536,    16384,   4096,    512,    256,    8,      4,     2,    1}},
-    {1073741832, {268435456, 8388608,   262144,    32768,    8192,     2048,    512,     256,    128,    16,     4,     2,    1}},
-    {1073741828, {134217728, 4194304,   131072,    16384,    4096,     1024,    256,     128,    64,     16,     8,     2,    1}},
-    {1073741826, {67108864,  2097152,   524288,    65536,    8192,     2048,    128,     64,     32,     16,     8,     4,    1}},
-    {1073741825, {33554432,  16777216,  1048576,   262144,   32768,    4096,    1024,    64,     32,     16,     8,     4,    2}},
-    {16777216,   {536870912}},
-    {8388608,    {268435456}},
-    {4194304,    {134217728}},
-    {2097152,    {67108864}},
-    {1048576,    {33554432}},
-    {524288,     {16777216}},
-    {262144,     {8388608}},
-    {131072,     {4194304}},
-    {65536,      {2097152}},
-    {32768,      {1048576}},
-    {16384,      {524288}},
-    {8192,       {262144}},
-    {4096,       {131072}},
-    {2048,       {65536}},
-    {1024,       {32768}},
-    {512,        {16384}},
-    {256,        {8192}},
-    {128,        {4096}},
-    {64,         {2048}},
-    {32,         {1024}},
-    {16,         {512}},
-    {8,          {256}},
-    {4,          {128}},
-    {2,          {64}},
-    {1,          {32}},
-};
-
-static std::unordered_map<unsigned int, unsigned int> KING_MOVE_MASKS_COMBINED = {
-    {536870912, 830472192},
-    {268435456, 968884224},
-    {134217728, 484442112},
-    {67108864,  242221056},
-    {33554432,  103809024},
-    {16777216,  831258624},
-    {8388608,   969801728},
-    {4194304,   484900864},
-    {2097152,   242450432},
-    {1048576,   103907328},
-    {524288,    25976832},
-    {262144,    30306304},
-    {131072,    15153152},
-    {65536,     7576576},
-    {32768,     3247104},
-    {16384,     811776},
-    {8192,      947072},
-    {4096,      473536},
-    {2048,      236768},
-    {1024,      101472},
-    {512,       25368},
-    {256,       29596},
-    {128,       14798},
-    {64,        7399},
-    {32,        3171},
-    {16,        792},
-    {8,         924},
-    {4,         462},
-    {2,         231},
-    {1,         99},
-};
-
-static std::unordered_map<unsigned int, unsigned int> QUEEN_MOVE_MASKS_COMBINED = {
-    {536870912, 1066027568},
-    {268435456, 1069884680},
-    {134217728, 1055559812},
-    {67108864,  1047873602},
-    {33554432,  1043506721},
-    {16777216,  838619729},
-    {8388608,   972957992},
-    {4194304,   502748292},
-    {2097152,   267627074},
-    {1048576,   133272881},
-    {524288,    697295506},
-    {262144,    365949257},
-    {131072,    720353956},
-    {65536,     343907666},
-    {32768,     171936937},
-    {16384,     625770260},
-    {8192,      313425802},
-    {4096,      156728789},
-    {2048,      614726890},
-    {1024,      307362917},
-    {512,       589980664},
-    {256,       278230012},
-    {128,       139115502},
-    {64,        86319079},
-    {32,        580030435},
-    {16,        555307807},
-    {8,         277130143},
-    {4,         138565087},
-    {2,         69806335},
-    {1,         51680383},
-};
-
-static std::unordered_map<unsigned int, unsigned int> BISHOP_MOVE_MASKS_COMBINED = {
-    {536870912, 830605344},
-    {268435456, 968950784},
-    {134217728, 484999168},
-    {67108864,  242499584},
-    {33554432,  103948800},
-    {16777216,  831262785},
-    {8388608,   969803808},
-    {4194304,   484918272},
-    {2097152,   242459136},
-    {1048576,   103911696},
-    {524288,    160194690},
-    {262144,    97415233},
-    {131072,    585579040},
-    {65536,     276012304},
-    {32768,     137464968},
-    {16384,     72114948},
-    {8192,      36598658},
-    {4096,      18299345},
-    {2048,      545496296},
-    {1024,      272731236},
-    {512,       35808024},
-    {256,       1143708},
-    {128,       571854},
-    {64,        17046759},
-    {32,        545393763},
-    {16,        1119000},
-    {8,         35740},
-    {4,         17870},
-    {2,         532711},
-    {1,         17043555},
-};
-
-static std::unordered_map<unsigned int, unsigned int> KNIGHT_MOVE_MASKS_COMBINED = {
-    {536870912, 541327360},
-    {268435456, 271187968},
-    {134217728, 152371200},
-    {67108864,  75661312},
-    {33554432,  37814272},
-    {16777216,  151134208},
-    {8388608,   75583488},
-    {4194304,   575186944},
-    {2097152,   270799872},
-    {1048576,   135399424},
-    {524288,    273158400},
-    {262144,    673450624},
-    {131072,    353518912},
-    {65536,     176234656},
-    {32768,     71340096},
-    {16384,     8536200},
-    {8192,      21045332},
-    {4096,      11047466},
-    {2048,      5507333},
-    {1024,      2229378},
-    {512,       266756},
-    {256,       657666},
-    {128,       345233},
-    {64,        172104},
-    {32,        69668},
-    {16,        8336},
-    {8,         20552},
-    {4,         10788},
-    {2,         5378},
-    {1,         2177},
-};
-
-static std::unordered_map<unsigned int, unsigned int> ROOK_MOVE_MASKS_COMBINED = {
-    {536870912, 1057505808},
-    {268435456, 1048846600},
-    {134217728, 1044516996},
-    {67108864,  1042352194},
-    {33554432,  1041269793},
-    {16777216,  569917968},
-    {8388608,   301211912},
-    {4194304,   166858884},
-    {2097152,   99682370},
-    {1048576,   66094113},
-    {524288,    554680848},
-    {262144,    277848328},
-    {131072,    139432068},
-    {65536,     70223938},
-    {32768,     35619873},
-    {16384,     554204688},
-    {8192,      277118216},
-    {4096,      138574980},
-    {2048,      69303362},
-    {1024,      34667553},
-    {512,       554189808},
-    {256,       277095400},
-    {128,       138548196},
-    {64,        69274594},
-    {32,        34637793},
-    {16,        554189343},
-    {8,         277094687},
-    {4,         138547359},
-    {2,         69273695},
-    {1,         34636863},
-};
-
-static std::unordered_map<unsigned int, unsigned int> BLACK_PAWN_MOVE_MASKS_COMBINED = {
-    {536870912, 553648128},
-    {268435456, 276824064},
-    {134217728, 138412032},
-    {67108864,  69206016},
-    {33554432,  34603008},
-    {16777216,  17301504},
-    {8388608,   8650752},
-    {4194304,   4325376},
-    {2097152,   2162688},
-    {1048576,   1081344},
-    {524288,    540672},
-    {262144,    270336},
-    {131072,    135168},
-    {65536,     67584},
-    {32768,     33792},
-    {16384,     16896},
-    {8192,      8448},
-    {4096,      4224},
-    {2048,      2112},
-    {1024,      1056},
-    {512,       528},
-    {256,       264},
-    {128,       132},
-    {64,        66},
-    {32,        33},
-    {16,        16},
-    {8,         8},
-    {4,         4},
-    {2,         2},
-    {1,         1},
-};
-
-static std::unordered_map<unsigned int, unsigned int> WHITE_PAWN_MOVE_MASKS_COMBINED = {
-    {536870912, 536870912},
-    {268435456, 268435456},
-    {134217728, 134217728},
-    {67108864,  67108864},
-    {33554432,  33554432},
-    {16777216,  553648128},
-    {8388608,   276824064},
-    {4194304,   138412032},
-    {2097152,   69206016},
-    {1048576,   34603008},
-    {524288,    17301504},
-    {262144,    8650752},
-    {131072,    4325376},
-    {65536,     2162688},
-    {32768,     1081344},
-    {16384,     540672},
-    {8192,      270336},
-    {4096,      135168},
-    {2048,      67584},
-    {1024,      33792},
-    {512,       16896},
-    {256,       8448},
-    {128,       4224},
-    {64,        2112},
-    {32,        1056},
-    {16,        528},
-    {8,         264},
-    {4,         132},
-    {2,         66},
-    {1,         33},
-};
-
-static Shadow_Mask SHADOW_MASK = {
-    {
-        1610612736, {
-                        {1342177280, 234881024},
-                        {1207959552, 100663296},
-                        {1140850688, 33554432},
-                        {1090519040, 541200},
-                        {1082130432, 133152},
-                        {1074266112, 16912},
-                        {1073872896, 2080},
-                        {1073758208, 528},
-                        {1073743872, 32},
-                        {1073742336, 16},
-                        {268435456, 234881024},
-                        {134217728, 100663296},
-                        {67108864, 33554432},
-                        {16777216, 541200},
-                        {8388608, 133152},
-                        {524288, 16912},
-                        {131072, 2080},
-                        {16384, 528},
-                        {2048, 32},
-                        {512, 16},
-                    }
-    },
-    {
-        1342177280, {
-                        {1207959552, 100663296},
-                        {1140850688, 33554432},
-                        {1082130432, 270600},
-                        {1077936128, 66560},
-                        {1074003968, 8456},
-                        {1073807360, 1024},
-                        {1073750016, 264},
-                        {1073742080, 8},
-                        {134217728,  100663296},
-                        {67108864,   33554432},
-                        {8388608,   270600},
-                        {4194304,   66560},
-                        {262144,   8456},
-                        {65536,    1024},
-                        {8192,    264},
-                        {256,    8},
-                    }
-    },
-    {
-        1207959552, {
-                        {1342177280, 536870912},
-                        {1140850688, 33554432},
-                        {1082130432, 524288},
-                        {1077936128, 135300},
-                        {1075838976, 32768},
-                        {1073872896, 4228},
-                        {1073745920, 132},
-                        {1073741952, 4},
-                        {268435456,  536870912},
-                        {67108864,   33554432},
-                        {8388608,   524288},
-                        {4194304,   135300},
-                        {2097152,  32768},
-                        {131072,   4228},
-                        {4096,    132},
-                        {128,    4},
-                    }
-    },
-    {
-        1140850688, {
-                        {1342177280, 536870912},
-                        {1207959552, 805306368},
-                        {1077936128, 278528},
-                        {1075838976, 67650},
-                        {1074003968, 16384},
-                        {1073807360, 2114},
-                        {1073743872, 66},
-                        {1073741888, 2},
-                        {268435456,  536870912},
-                        {134217728,  805306368},
-                        {4194304,   278528},
-                        {2097152,   67650},
-                        {262144,   16384},
-                        {65536,    2114},
-                        {2048,    66},
-                        {64,     2},
-                    }
-    },
-    {
-        1107296256, {
-                        {1342177280, 536870912},
-                        {1207959552, 805306368},
-                        {1140850688, 939524096},
-                        {1075838976, 139776},
-                        {1074790400, 33825},
-                        {1073872896, 8704},
-                        {1073774592, 1057},
-                        {1073750016, 512},
-                        {1073742848, 33},
-                        {1073741856, 1},
-                        {268435456, 536870912},
-                        {134217728, 805306368},
-                        {67108864, 939524096},
-                        {2097152,  139776},
-                        {1048576, 33825},
-                        {131072, 8704},
-                        {32768,  1057},
-                        {8192,  512},
-                        {1024, 33},
-                        {32,  1},
-                    }
-    },
-    {
-        1090519040, {
-                        {1082130432, 7340032},
-                        {1077936128, 3145728},
-                        {1075838976, 1048576},
-                        {1074266112, 16912},
-                        {1074003968, 4161},
-                        {1073758208, 528},
-                        {1073745920, 65},
-                        {1073742336, 16},
-                        {1073741888, 1},
-                        {8388608,    7340032},
-                        {4194304,   3145728},
-                        {2097152,   1048576},
-                        {524288,   16912},
-                        {262144,   4161},
-                        {16384,   528},
-                        {4096,   65},
-                        {512,    16},
-                        {64,    1},
-                    }
-    },
-    {
-        1082130432, {
-                        {1077936128, 3145728},
-                        {1075838976, 1048576},
-                        {1074003968, 8456},
-                        {1073872896, 2080},
-                        {1073750016, 264},
-                        {1073743872, 32},
-                        {1073742080, 8},
-                        {4194304,    3145728},
-                        {2097152,    1048576},
-                        {262144,     8456},
-                        {131072,    2080},
-                        {8192,      264},
-                        {2048,     32},
-                        {256,      8},
-                    }
-    },
-    {
-        1077936128, {
-                        {1082130432, 16777216},
-                        {1075838976, 1048576},
-                        {1074003968, 16384},
-                        {1073872896, 4228},
-                        {1073807360, 1024},
-                        {1073745920, 132},
-                        {1073741952, 4},
-                        {8388608,    16777216},
-                        {2097152,    1048576},
-                        {262144,     16384},
-                        {131072,    4228},
-                        {65536,     1024},
-                        {4096,     132},
-                        {128,      4},
-                    }
-    },
-    {
-        1075838976, {
-                        {1082130432, 16777216},
-                        {1077936128, 25165824},
-                        {1073872896, 8704},
-                        {1073807360, 2114},
-                        {1073750016, 512},
-                        {1073743872, 66},
-                        {1073741888, 2},
-                        {8388608,    16777216},
-                        {4194304,    25165824},
-                        {131072,     8704},
-                        {65536,     2114},
-                        {8192,      512},
-                        {2048,     66},
-                        {64,       2},
-                    }
-    },
-    {
-        1074790400, {
-                        {1082130432, 16777216},
-                        {1077936128, 25165824},
-                        {1075838976, 29360128},
-                        {1073807360, 4368},
-                        {1073774592, 1057},
-                        {1073745920, 272},
-                        {1073742848, 33},
-                        {1073742080, 16},
-                        {1073741856, 1},
-                        {8388608,    16777216},
-                        {4194304,   25165824},
-                        {2097152,   29360128},
-                        {65536,    4368},
-                        {32768,    1057},
-                        {4096,    272},
-                        {1024,   33},
-                        {256,    16},
-                        {32,    1},
-                    }
-    },
-    {
-        1074266112, {
-                        {1090519040, 536870912},
-                        {1082130432, 134217728},
-                        {1074003968, 229376},
-                        {1073872896, 98304},
-                        {1073807360, 32768},
-                        {1073758208, 528},
-                        {1073750016, 130},
-                        {1073742336, 16},
-                        {1073741952, 2},
-                        {16777216,   536870912},
-                        {8388608,   134217728},
-                        {262144,    229376},
-                        {131072,   98304},
-                        {65536,    32768},
-                        {16384,   528},
-                        {8192,   130},
-                        {512,    16},
-                        {128,   2},
-                    }
-    },
-    {
-        1074003968, {
-                        {1082130432, 268435456},
-                        {1077936128, 67108864},
-                        {1073872896, 98304},
-                        {1073807360, 32768},
-                        {1073750016, 264},
-                        {1073745920, 65},
-                        {1073742080, 8},
-                        {1073741888, 1},
-                        {8388608,    268435456},
-                        {4194304,    67108864},
-                        {131072,    98304},
-                        {65536,     32768},
-                        {8192,     264},
-                        {4096,     65},
-                        {256,     8},
-                        {64,     1},
-                    }
-    },
-    {
-        1073872896, {
-                        {1082130432, 536870912},
-                        {1077936128, 134217728},
-                        {1075838976, 33554432},
-                        {1074003968, 524288},
-                        {1073807360, 32768},
-                        {1073750016, 512},
-                        {1073745920, 132},
-                        {1073743872, 32},
-                        {1073741952, 4},
-                        {8388608,    536870912},
-                        {4194304,   134217728},
-                        {2097152,   33554432},
-                        {262144,   524288},
-                        {65536,    32768},
-                        {8192,    512},
-                        {4096,   132},
-                        {2048,   32},
-                        {128,   4},
-                    }
-    },
-    {
-        1073807360, {
-                        {1077936128, 268435456},
-                        {1075838976, 67108864},
-                        {1074003968, 524288},
-                        {1073872896, 786432},
-                        {1073745920, 272},
-                        {1073743872, 66},
-                        {1073742080, 16},
-                        {1073741888, 2},
-                        {4194304,    268435456},
-                        {2097152,    67108864},
-                        {262144,    524288},
-                        {131072,    786432},
-                        {4096,     272},
-                        {2048,     66},
-                        {256,     16},
-                        {64,     2},
-                    }
-    },
-    {
-        1073774592, {
-                        {1075838976, 134217728},
-                        {1074790400, 33554432},
-                        {1074003968, 524288},
-                        {1073872896, 786432},
-                        {1073807360, 917504},
-                        {1073743872, 136},
-                        {1073742848, 33},
-                        {1073741952, 8},
-                        {1073741856, 1},
-                        {2097152,    134217728},
-                        {1048576,   33554432},
-                        {262144,    524288},
-                        {131072,   786432},
-                        {65536,    917504},
-                        {2048,    136},
-                        {1024,   33},
-                        {128,    8},
-                        {32,    1},
-                    }
-    },
-    {
-        1073758208, {
-                        {1090519040, 536870912},
-                        {1077936128, 67108864},
-                        {1074266112, 553648128},
-                        {1074003968, 71303168},
-                        {1073750016, 7168},
-                        {1073745920, 3072},
-                        {1073743872, 1024},
-                        {1073742336, 16},
-                        {1073742080, 4},
-                        {16777216,   536870912},
-                        {4194304,   67108864},
-                        {524288,    553648128},
-                        {262144,   71303168},
-                        {8192,     7168},
-                        {4096,    3072},
-                        {2048,   1024},
-                        {512,    16},
-                        {256,   4},
-                    }
-    },
-    {
-        1073750016, {
-                        {1082130432, 268435456},
-                        {1075838976, 33554432},
-                        {1074003968, 276824064},
-                        {1073872896, 35651584},
-                        {1073745920, 3072},
-                        {1073743872, 1024},
-                        {1073742080, 8},
-                        {1073741952, 2},
-                        {8388608,    268435456},
-                        {2097152,    33554432},
-                        {262144,    276824064},
-                        {131072,    35651584},
-                        {4096,     3072},
-                        {2048,     1024},
-                        {256,     8},
-                        {128,    2},
-                    }
-    },
-    {
-        1073745920, {
-                        {1077936128, 134217728},
-                        {1074003968, 16777216},
-                        {1073872896, 138412032},
-                        {1073807360, 1048576},
-                        {1073750016, 16384},
-                        {1073743872, 1024},
-                        {1073742080, 16},
-                        {1073741952, 4},
-                        {1073741888, 1},
-                        {4194304,    134217728},
-                        {262144,    16777216},
-                        {131072,    138412032},
-                        {65536,    1048576},
-                        {8192,     16384},
-                        {2048,    1024},
-                        {256,    16},
-                        {128,    4},
-                        {64,    1},
-                    }
-    },
-    {
-        1073743872, {
-                        {1082130432, 536870912},
-                        {1075838976, 67108864},
-                        {1073872896, 545259520},
-                        {1073807360, 69206016},
-                        {1073750016, 16384},
-                        {1073745920, 24576},
-                        {1073741952, 8},
-                        {1073741888, 2},
-                        {8388608,    536870912},
-                        {2097152,    67108864},
-                        {131072,    545259520},
-                        {65536,     69206016},
-                        {8192,     16384},
-                        {4096,     24576},
-                        {128,     8},
-                        {64,     2},
-                    }
-    },
-    {
-        1073742848, {
-                        {1077936128, 268435456},
-                        {1074790400, 33554432},
-                        {1073807360, 272629760},
-                        {1073774592, 34603008},
-                        {1073750016, 16384},
-                        {1073745920, 24576},
-                        {1073743872, 28672},
-                        {1073741888, 4},
-                        {1073741856, 1},
-                        {4194304,    268435456},
-                        {1048576,   33554432},
-                        {65536,     272629760},
-                        {32768,    34603008},
-                        {8192,     16384},
-                        {4096,    24576},
-                        {2048,   28672},
-                        {64,     4},
-                        {32,    1},
-                    }
-    },
-    {
-        1073742336, {
-                        {1090519040, 536870912},
-                        {1075838976, 33554432},
-                        {1074266112, 553648128},
-                        {1073872896, 35651584},
-                        {1073758208, 554172416},
-                        {1073750016, 35782656},
-                        {1073742080, 224},
-                        {1073741952, 96},
-                        {1073741888, 32},
-                        {16777216,   536870912},
-                        {2097152,   33554432},
-                        {524288,    553648128},
-                        {131072,   35651584},
-                        {16384,    554172416},
-                        {8192,    35782656},
-                        {256,    224},
-                        {128,    96},
-                        {64,    32},
-                    }
-    },
-    {
-        1073742080, {
-                        {1082130432, 268435456},
-                        {1074003968, 276824064},
-                        {1073807360, 1048576},
-                        {1073750016, 277086208},
-                        {1073745920, 1114112},
-                        {1073741952, 96},
-                        {1073741888, 32},
-                        {8388608,    268435456},
-                        {262144,     276824064},
-                        {65536,      1048576},
-                        {8192,      277086208},
-                        {4096,      1114112},
-                        {128,      96},
-                        {64,       32},
-                    }
-    },
-    {
-        1073741952, {
-                        {1077936128, 134217728},
-                        {1073872896, 138412032},
-                        {1073750016, 524288},
-                        {1073745920, 138543104},
-                        {1073743872, 32768},
-                        {1073742080, 512},
-                        {1073741888, 32},
-                        {4194304,    134217728},
-                        {131072,     138412032},
-                        {8192,       524288},
-                        {4096,      138543104},
-                        {2048,      32768},
-                        {256,      512},
-                        {64,       32},
-                    }
-    },
-    {
-        1073741888, {
-                        {1075838976, 67108864},
-                        {1074003968, 16777216},
-                        {1073807360, 69206016},
-                        {1073745920, 17039360},
-                        {1073743872, 69271552},
-                        {1073742080, 512},
-                        {1073741952, 768},
-                        {2097152,    67108864},
-                        {262144,     16777216},
-                        {65536,      69206016},
-                        {4096,      17039360},
-                        {2048,      69271552},
-                        {256,      512},
-                        {128,      768},
-                    }
-    },
-    {
-        1073741856, {
-                        {1082130432, 536870912},
-                        {1074790400, 33554432},
-                        {1073872896, 545259520},
-                        {1073774592, 34603008},
-                        {1073743872, 545390592},
-                        {1073742848, 34635776},
-                        {1073742080, 512},
-                        {1073741952, 768},
-                        {1073741888, 896},
-                        {8388608,    536870912},
-                        {1048576,   33554432},
-                        {131072,    545259520},
-                        {32768,    34603008},
-                        {2048,     545390592},
-                        {1024,    34635776},
-                        {256,    512},
-                        {128,    768},
-                        {64,    896},
-                    }
-    },
-    {
-        1073741840, {
-                        {1090519040, 536870912},
-                        {1074266112, 553648128},
-                        {1073807360, 1048576},
-                        {1073758208, 554172416},
-                        {1073745920, 1114112},
-                        {1073742336, 554188800},
-                        {1073742080, 1118208},
-                        {1073741832, 7},
-                        {1073741828, 3},
-                        {1073741826, 1},
-                        {16777216,  536870912},
-                        {524288,    553648128},
-                        {65536,    1048576},
-                        {16384,    554172416},
-                        {4096,    1114112},
-                        {512,    554188800},
-                        {256,    1118208},
-                        {8,     7},
-                        {4,    3},
-                        {2,   1},
-                    }
-    },
-    {
-        1073741832, {
-                        {1082130432, 268435456},
-                        {1074003968, 276824064},
-                        {1073750016, 277086208},
-                        {1073743872, 32768},
-                        {1073742080, 277094400},
-                        {1073741952, 34816},
-                        {1073741828, 3},
-                        {1073741826, 1},
-                        {8388608,    268435456},
-                        {262144,     276824064},
-                        {8192,      277086208},
-                        {2048,      32768},
-                        {256,      277094400},
-                        {128,      34816},
-                        {4,       3},
-                        {2,      1},
-                    }
-    },
-    {
-        1073741828, {
-                        {1077936128, 134217728},
-                        {1073872896, 138412032},
-                        {1073745920, 138543104},
-                        {1073742080, 16384},
-                        {1073741952, 138547200},
-                        {1073741888, 1024},
-                        {1073741832, 16},
-                        {1073741826, 1},
-                        {4194304,    134217728},
-                        {131072,     138412032},
-                        {4096,      138543104},
-                        {256,       16384},
-                        {128,      138547200},
-                        {64,       1024},
-                        {8,       16},
-                        {2,      1},
-                    }
-    },
-    {
-        1073741826, {
-                        {1075838976, 67108864},
-                        {1073807360, 69206016},
-                        {1073750016, 524288},
-                        {1073743872, 69271552},
-                        {1073741952, 532480},
-                        {1073741888, 69273600},
-                        {1073741832, 16},
-                        {1073741828, 24},
-                        {2097152,    67108864},
-                        {65536,      69206016},
-                        {8192,      524288},
-                        {2048,      69271552},
-                        {128,      532480},
-                        {64,       69273600},
-                        {8,       16},
-                        {4,      24},
-                    }
-    },
-    {
-        1073741825, {
-                        {1074790400, 33554432},
-                        {1074003968, 16777216},
-                        {1073774592, 34603008},
-                        {1073745920, 17039360},
-                        {1073742848, 34635776},
-                        {1073741888, 17043456},
-                        {1073741856, 34636800},
-                        {1073741832, 16},
-                        {1073741828, 24},
-                        {1073741826, 28},
-                        {1048576,   33554432},
-                        {262144,    16777216},
-                        {32768,    34603008},
-                        {4096,     17039360},
-                        {1024,    34635776},
-                        {64,     17043456},
-                        {32,     34636800},
-                        {8,     16},
-                        {4,    24},
-                        {2,   28},
-                    }
-    },
-    {
-        536870912,  {
-                        {1342177280, 234881024},
-                        {1207959552, 100663296},
-                        {1140850688, 33554432},
-                        {1090519040, 541200},
-                        {1082130432, 133152},
-                        {1074266112, 16912},
-                        {1073872896, 2080},
-                        {1073758208, 528},
-                        {1073743872, 32},
-                        {1073742336, 16},
-                        {268435456, 234881024},
-                        {134217728, 100663296},
-                        {67108864, 33554432},
-                        {16777216, 541200},
-                        {8388608, 133152},
-                        {524288, 16912},
-                        {131072, 2080},
-                        {16384, 528},
-                        {2048, 32},
-                        {512, 16},
-                    }
-    },
-    {
-        268435456,  {
-                        {1207959552, 100663296},
-                        {1140850688, 33554432},
-                        {1082130432, 270600},
-                        {1077936128, 66560},
-                        {1074003968, 8456},
-                        {1073807360, 1024},
-                        {1073750016, 264},
-                        {1073742080, 8},
-                        {134217728,  100663296},
-                        {67108864,   33554432},
-                        {8388608,   270600},
-                        {4194304,   66560},
-                        {262144,   8456},
-                        {65536,    1024},
-                        {8192,    264},
-                        {256,    8},
-                    }
-    },
-    {
-        134217728,  {
-                        {1342177280, 536870912},
-                        {1140850688, 33554432},
-                        {1082130432, 524288},
-                        {1077936128, 135300},
-                        {1075838976, 32768},
-                        {1073872896, 4228},
-                        {1073745920, 132},
-                        {1073741952, 4},
-                        {268435456,  536870912},
-                        {67108864,   33554432},
-                        {8388608,   524288},
-                        {4194304,   135300},
-                        {2097152,  32768},
-                        {131072,   4228},
-                        {4096,    132},
-                        {128,    4},
-                    }
-    },
-    {
-        67108864,   {
-                        {1342177280, 536870912},
-                        {1207959552, 805306368},
-                        {1077936128, 278528},
-                        {1075838976, 67650},
-                        {1074003968, 16384},
-                        {1073807360, 2114},
-                        {1073743872, 66},
-                        {1073741888, 2},
-                        {268435456,  536870912},
-                        {134217728,  805306368},
-                        {4194304,   278528},
-                        {2097152,   67650},
-                        {262144,   16384},
-                        {65536,    2114},
-                        {2048,    66},
-                        {64,     2},
-                    }
-    },
-    {
-        33554432,   {
-                        {1342177280, 536870912},
-                        {1207959552, 805306368},
-                        {1140850688, 939524096},
-                        {1075838976, 139776},
-                        {1074790400, 33825},
-                        {1073872896, 8704},
-                        {1073774592, 1057},
-                        {1073750016, 512},
-                        {1073742848, 33},
-                        {1073741856, 1},
-                        {268435456, 536870912},
-                        {134217728, 805306368},
-                        {67108864, 939524096},
-                        {2097152,  139776},
-                        {1048576, 33825},
-                        {131072, 8704},
-                        {32768,  1057},
-                        {8192,  512},
-                        {1024, 33},
-                        {32,  1},
-                    }
-    },
-    {
-        16777216,   {
-                        {1082130432, 7340032},
-                        {1077936128, 3145728},
-                        {1075838976, 1048576},
-                        {1074266112, 16912},
-                        {1074003968, 4161},
-                        {1073758208, 528},
-                        {1073745920, 65},
-                        {1073742336, 16},
-                        {1073741888, 1},
-                        {8388608,    7340032},
-                        {4194304,   3145728},
-                        {2097152,   1048576},
-                        {524288,   16912},
-                        {262144,   4161},
-                        {16384,   528},
-                        {4096,   65},
-                        {512,    16},
-                        {64,    1},
-                    }
-    },
-    {
-        8388608,    {
-                        {1077936128, 3145728},
-                        {1075838976, 1048576},
-                        {1074003968, 8456},
-                        {1073872896, 2080},
-                        {1073750016, 264},
-                        {1073743872, 32},
-                        {1073742080, 8},
-                        {4194304,    3145728},
-                        {2097152,    1048576},
-                        {262144,     8456},
-                        {131072,    2080},
-                        {8192,      264},
-                        {2048,     32},
-                        {256,      8},
-                    }
-    },
-    {
-        4194304,    {
-                        {1082130432, 16777216},
-                        {1075838976, 1048576},
-                        {1074003968, 16384},
-                        {1073872896, 4228},
-                        {1073807360, 1024},
-                        {1073745920, 132},
-                        {1073741952, 4},
-                        {8388608,    16777216},
-                        {2097152,    1048576},
-                        {262144,     16384},
-                        {131072,    4228},
-                        {65536,     1024},
-                        {4096,     132},
-                        {128,      4},
-                    }
-    },
-    {
-        2097152,    {
-                        {1082130432, 16777216},
-                        {1077936128, 25165824},
-                        {1073872896, 8704},
-                        {1073807360, 2114},
-                        {1073750016, 512},
-                        {1073743872, 66},
-                        {1073741888, 2},
-                        {8388608,    16777216},
-                        {4194304,    25165824},
-                        {131072,     8704},
-                        {65536,     2114},
-                        {8192,      512},
-                        {2048,     66},
-                        {64,       2},
-                    }
-    },
-    {
-        1048576,    {
-                        {1082130432, 16777216},
-                        {1077936128, 25165824},
-                        {1075838976, 29360128},
-                        {1073807360, 4368},
-                        {1073774592, 1057},
-                        {1073745920, 272},
-                        {1073742848, 33},
-                        {1073742080, 16},
-                        {1073741856, 1},
-                        {8388608,    16777216},
-                        {4194304,   25165824},
-                        {2097152,   29360128},
-                        {65536,    4368},
-                        {32768,    1057},
-                        {4096,    272},
-                        {1024,   33},
-                        {256,    16},
-                        {32,    1},
-                    }
-    },
-    {
-        524288,     {
-                        {1090519040, 536870912},
-                        {1082130432, 134217728},
-                        {1074003968, 229376},
-                        {1073872896, 98304},
-                        {1073807360, 32768},
-                        {1073758208, 528},
-                        {1073750016, 130},
-                        {1073742336, 16},
-                        {1073741952, 2},
-                        {16777216,   536870912},
-                        {8388608,   134217728},
-                        {262144,    229376},
-                        {131072,   98304},
-                        {65536,    32768},
-                        {16384,   528},
-                        {8192,   130},
-                        {512,    16},
-                        {128,   2},
-                    }
-    },
-    {
-        262144,     {
-                        {1082130432, 268435456},
-                        {1077936128, 67108864},
-                        {1073872896, 98304},
-                        {1073807360, 32768},
-                        {1073750016, 264},
-                        {1073745920, 65},
-                        {1073742080, 8},
-                        {1073741888, 1},
-                        {8388608,    268435456},
-                        {4194304,    67108864},
-                        {131072,    98304},
-                        {65536,     32768},
-                        {8192,     264},
-                        {4096,     65},
-                        {256,     8},
-                        {64,     1},
-                    }
-    },
-    {
-        131072,     {
-                        {1082130432, 536870912},
-                        {1077936128, 134217728},
-                        {1075838976, 33554432},
-                        {1074003968, 524288},
-                        {1073807360, 32768},
-                        {1073750016, 512},
-                        {1073745920, 132},
-                        {1073743872, 32},
-                        {1073741952, 4},
-                        {8388608,    536870912},
-                        {4194304,   134217728},
-                        {2097152,   33554432},
-                        {262144,   524288},
-                        {65536,    32768},
-                        {8192,    512},
-                        {4096,   132},
-                        {2048,   32},
-                        {128,   4},
-                    }
-    },
-    {
-        65536,      {
-                        {1077936128, 268435456},
-                        {1075838976, 67108864},
-                        {1074003968, 524288},
-                        {1073872896, 786432},
-                        {1073745920, 272},
-                        {1073743872, 66},
-                        {1073742080, 16},
-                        {1073741888, 2},
-                        {4194304,    268435456},
-                        {2097152,    67108864},
-                        {262144,    524288},
-                        {131072,    786432},
-                        {4096,     272},
-                        {2048,     66},
-                        {256,     16},
-                        {64,     2},
-                    }
-    },
-    {
-        32768,      {
-                        {1075838976, 134217728},
-                        {1074790400, 33554432},
-                        {1074003968, 524288},
-                        {1073872896, 786432},
-                        {1073807360, 917504},
-                        {1073743872, 136},
-                        {1073742848, 33},
-                        {1073741952, 8},
-                        {1073741856, 1},
-                        {2097152,    134217728},
-                        {1048576,   33554432},
-                        {262144,    524288},
-                        {131072,   786432},
-                        {65536,    917504},
-                        {2048,    136},
-                        {1024,   33},
-                        {128,    8},
-                        {32,    1},
-                    }
-    },
-    {
-        16384,      {
-                        {1090519040, 536870912},
-                        {1077936128, 67108864},
-                        {1074266112, 553648128},
-                        {1074003968, 71303168},
-                        {1073750016, 7168},
-                        {1073745920, 3072},
-                        {1073743872, 1024},
-                        {1073742336, 16},
-                        {1073742080, 4},
-                        {16777216,   536870912},
-                        {4194304,   67108864},
-                        {524288,    553648128},
-                        {262144,   71303168},
-                        {8192,     7168},
-                        {4096,    3072},
-                        {2048,   1024},
-                        {512,    16},
-                        {256,   4},
-                    }
-    },
-    {
-        8192,       {
-                        {1082130432, 268435456},
-                        {1075838976, 33554432},
-                        {1074003968, 276824064},
-                        {1073872896, 35651584},
-                        {1073745920, 3072},
-                        {1073743872, 1024},
-                        {1073742080, 8},
-                        {1073741952, 2},
-                        {8388608,    268435456},
-                        {2097152,    33554432},
-                        {262144,    276824064},
-                        {131072,    35651584},
-                        {4096,     3072},
-                        {2048,     1024},
-                        {256,     8},
-                        {128,    2},
-                    }
-    },
-    {
-        4096,       {
-                        {1077936128, 134217728},
-                        {1074003968, 16777216},
-                        {1073872896, 138412032},
-                        {1073807360, 1048576},
-                        {1073750016, 16384},
-                        {1073743872, 1024},
-                        {1073742080, 16},
-                        {1073741952, 4},
-                        {1073741888, 1},
-                        {4194304,    134217728},
-                        {262144,    16777216},
-                        {131072,    138412032},
-                        {65536,    1048576},
-                        {8192,     16384},
-                        {2048,    1024},
-                        {256,    16},
-                        {128,    4},
-                        {64,    1},
-                    }
-    },
-    {
-        2048,       {
-                        {1082130432, 536870912},
-                        {1075838976, 67108864},
-                        {1073872896, 545259520},
-                        {1073807360, 69206016},
-                        {1073750016, 16384},
-                        {1073745920, 24576},
-                        {1073741952, 8},
-                        {1073741888, 2},
-                        {8388608,    536870912},
-                        {2097152,    67108864},
-                        {131072,    545259520},
-                        {65536,     69206016},
-                        {8192,     16384},
-                        {4096,     24576},
-                        {128,     8},
-                        {64,     2},
-                    }
-    },
-    {
-        1024,       {
-                        {1077936128, 268435456},
-                        {1074790400, 33554432},
-                        {1073807360, 272629760},
-                        {1073774592, 34603008},
-                        {1073750016, 16384},
-                        {1073745920, 24576},
-                        {1073743872, 28672},
-                        {1073741888, 4},
-                        {1073741856, 1},
-                        {4194304,    268435456},
-                        {1048576,   33554432},
-                        {65536,     272629760},
-                        {32768,    34603008},
-                        {8192,     16384},
-                        {4096,    24576},
-                        {2048,   28672},
-                        {64,     4},
-                        {32,    1},
-                    }
-    },
-    {
-        512,        {
-                        {1090519040, 536870912},
-                        {1075838976, 33554432},
-                        {1074266112, 553648128},
-                        {1073872896, 35651584},
-                        {1073758208, 554172416},
-                        {1073750016, 35782656},
-                        {1073742080, 224},
-                        {1073741952, 96},
-                        {1073741888, 32},
-                        {16777216,   536870912},
-                        {2097152,   33554432},
-                        {524288,    553648128},
-                        {131072,   35651584},
-                        {16384,    554172416},
-                        {8192,    35782656},
-                        {256,    224},
-                        {128,    96},
-                        {64,    32},
-                    }
-    },
-    {
-        256,        {
-                        {1082130432, 268435456},
-                        {1074003968, 276824064},
-                        {1073807360, 1048576},
-                        {1073750016, 277086208},
-                        {1073745920, 1114112},
-                        {1073741952, 96},
-                        {1073741888, 32},
-                        {8388608,    268435456},
-                        {262144,     276824064},
-                        {65536,      1048576},
-                        {8192,      277086208},
-                        {4096,      1114112},
-                        {128,      96},
-                        {64,       32},
-                    }
-    },
-    {
-        128,        {
-                        {1077936128, 134217728},
-                        {1073872896, 138412032},
-                        {1073750016, 524288},
-                        {1073745920, 138543104},
-                        {1073743872, 32768},
-                        {1073742080, 512},
-                        {1073741888, 32},
-                        {4194304,    134217728},
-                        {131072,     138412032},
-                        {8192,       524288},
-                        {4096,      138543104},
-                        {2048,      32768},
-                        {256,      512},
-                        {64,       32},
-                    }
-    },
-    {
-        64,         {
-                        {1075838976, 67108864},
-                        {1074003968, 16777216},
-                        {1073807360, 69206016},
-                        {1073745920, 17039360},
-                        {1073743872, 69271552},
-                        {1073742080, 512},
-                        {1073741952, 768},
-                        {2097152,    67108864},
-                        {262144,     16777216},
-                        {65536,      69206016},
-                        {4096,      17039360},
-                        {2048,      69271552},
-                        {256,      512},
-                        {128,      768},
-                    }
-    },
-    {
-        32,         {
-                        {1082130432, 536870912},
-                        {1074790400, 33554432},
-                        {1073872896, 545259520},
-                        {1073774592, 34603008},
-                        {1073743872, 545390592},
-                        {1073742848, 34635776},
-                        {1073742080, 512},
-                        {1073741952, 768},
-                        {1073741888, 896},
-                        {8388608,    536870912},
-                        {1048576,   33554432},
-                        {131072,    545259520},
-                        {32768,    34603008},
-                        {2048,     545390592},
-                        {1024,    34635776},
-                        {256,    512},
-                        {128,    768},
-                        {64,    896},
-                    }
-    },
-    {
-        16,         {
-                        {1090519040, 536870912},
-                        {1074266112, 553648128},
-                        {1073807360, 1048576},
-                        {1073758208, 554172416},
-                        {1073745920, 1114112},
-                        {1073742336, 554188800},
-                        {1073742080, 1118208},
-                        {1073741832, 7},
-                        {1073741828, 3},
-                        {1073741826, 1},
-                        {16777216,  536870912},
-                        {524288,    553648128},
-                        {65536,    1048576},
-                        {16384,    554172416},
-                        {4096,    1114112},
-                        {512,    554188800},
-                        {256,    1118208},
-                        {8,     7},
-                        {4,    3},
-                        {2,   1},
-                    }
-    },
-    {
-        8,          {
-                        {1082130432, 268435456},
-                        {1074003968, 276824064},
-                        {1073750016, 277086208},
-                        {1073743872, 32768},
-                        {1073742080, 277094400},
-                        {1073741952, 34816},
-                        {1073741828, 3},
-                        {1073741826, 1},
-                        {8388608,    268435456},
-                        {262144,     276824064},
-                        {8192,      277086208},
-                        {2048,      32768},
-                        {256,      277094400},
-                        {128,      34816},
-                        {4,       3},
-                        {2,      1},
-                    }
-    },
-    {
-        4,          {
-                        {1077936128, 134217728},
-                        {1073872896, 138412032},
-                        {1073745920, 138543104},
-                        {1073742080, 16384},
-                        {1073741952, 138547200},
-                        {1073741888, 1024},
-                        {1073741832, 16},
-                        {1073741826, 1},
-                        {4194304,    134217728},
-                        {131072,     138412032},
-                        {4096,      138543104},
-                        {256,       16384},
-                        {128,      138547200},
-                        {64,       1024},
-                        {8,       16},
-                        {2,      1},
-                    }
-    },
-    {
-        2,          {
-                        {1075838976, 67108864},
-                        {1073807360, 69206016},
-                        {1073750016, 524288},
-                        {1073743872, 69271552},
-                        {1073741952, 532480},
-                        {1073741888, 69273600},
-                        {1073741832, 16},
-                        {1073741828, 24},
-                        {2097152,    67108864},
-                        {65536,      69206016},
-                        {8192,      524288},
-                        {2048,      69271552},
-                        {128,      532480},
-                        {64,       69273600},
-                        {8,       16},
-                        {4,      24},
-                    }
-    },
-    {
-        1,          {
-                        {1074790400, 33554432},
-                        {1074003968, 16777216},
-                        {1073774592, 34603008},
-                        {1073745920, 17039360},
-                        {1073742848, 34635776},
-                        {1073741888, 17043456},
-                        {1073741856, 34636800},
-                        {1073741832, 16},
-                        {1073741828, 24},
-                        {1073741826, 28},
-                        {1048576,   33554432},
-                        {262144,    16777216},
-                        {32768,    34603008},
-                        {4096,     17039360},
-                        {1024,    34635776},
-                        {64,     17043456},
-                        {32,     34636800},
-                        {8,     16},
-                        {4,    24},
-                        {2,   28},
-                    }
-    },
-};
-
-static std::unordered_map<unsigned int, int> begin_white_queen_heuristic = {
-    {536870912, -200}, {268435456, -200}, {134217728, -200}, {67108864, -200}, {33554432, -200},
-    {16777216,  -200}, {8388608,   -200}, {4194304,   -200}, {2097152,  -200}, {1048576,  -200},
-    {524288,    -200}, {262144,    -200}, {131072,    -200}, {65536,    -200}, {32768,    -200},
-    {16384,     -200}, {8192,      -200}, {4096,      -200}, {2048,     -200}, {1024,     -200},
-    {512,       -200}, {256,       -200}, {128,       -200}, {64,       -200}, {32,        200},
-    {16,           0}, {8,            0}, {4,            0}, {2,           0}, {1,           0},
-    {0, -5000}
-};
-
-static std::unordered_map<unsigned int, int> begin_black_queen_heuristic = {
-    {536870912,  0}, {268435456,  0}, {134217728,  0}, {67108864,   0}, {33554432,   0},
-    {16777216, 200}, {8388608, -200}, {4194304, -200}, {2097152, -200}, {1048576, -200},
-    {524288,  -200}, {262144,  -200}, {131072,  -200}, {65536,   -200}, {32768,   -200},
-    {16384,   -200}, {8192,    -200}, {4096,    -200}, {2048,    -200}, {1024,    -200},
-    {512,     -200}, {256,     -200}, {128,     -200}, {64,      -200}, {32,      -200},
-    {16,      -200}, {8,       -200}, {4,       -200}, {2,       -200}, {1,       -200},
-    {0, -5000}
-};
-
-static std::unordered_map<unsigned int, int> white_queen_heuristic = {
-    {536870912, -20}, {268435456, -10}, {134217728, -5}, {67108864, -10}, {33554432, -20},
-    {16777216,  -10}, {8388608,     0}, {4194304,    0}, {2097152,    0}, {1048576,  -10},
-    {524288,    -10}, {262144,      5}, {131072,     5}, {65536,      5}, {32768,    -10},
-    {16384,       0}, {8192,        5}, {4096,       5}, {2048,       5}, {1024,       0},
-    {512,       -10}, {256,         5}, {128,        5}, {64,         5}, {32,       -10},
-    {16,        -20}, {8,         -10}, {4,         -5}, {2,        -10}, {1,        -20},
-    {0, 0}
-};
-
-static std::unordered_map<unsigned int, int> black_queen_heuristic = {
-    {536870912, -20}, {268435456, -10}, {134217728, -5}, {67108864, -10}, {33554432, -20},
-    {16777216,  -10}, {8388608,     5}, {4194304,    5}, {2097152,    5}, {1048576,  -10},
-    {524288,      0}, {262144,      5}, {131072,     5}, {65536,      5}, {32768,      0},
-    {16384,     -10}, {8192,        5}, {4096,       5}, {2048,       5}, {1024,     -10},
-    {512,       -10}, {256,         0}, {128,        0}, {64,         0}, {32,       -10},
-    {16,        -20}, {8,         -10}, {4,         -5}, {2,        -10}, {1,        -20},
-    {0, 0}
-};
-
-static std::unordered_map<unsigned int, int> white_pawn_heuristic = {
-    // Promoted Pawns
-    {1610612736, -20}, {1342177280, -10}, {1207959552, -5}, {1140850688, -10}, {1107296256, -20},
-    {1090519040, -10}, {1082130432,   0}, {1077936128,  0}, {1075838976,   0}, {1074790400, -10},
-    {1074266112, -10}, {1074003968,   5}, {1073872896,  5}, {1073807360,   5}, {1073774592, -10},
-    {1073758208,   0}, {1073750016,   5}, {1073745920,  5}, {1073743872,   5}, {1073742848,   0},
-    {1073742336, -10}, {1073742080,   5}, {1073741952,  5}, {1073741888,   5}, {1073741856, -10},
-    {1073741840, -20}, {1073741832, -10}, {1073741828, -5}, {1073741826, -10}, {1073741825, -20},
-
-    // Regular Pawns
-    {536870912, 900}, {268435456, 900}, {134217728, 900}, {67108864, 900}, {33554432, 900},
-    {16777216,  500}, {8388608,   500}, {4194304,   500}, {2097152,  500}, {1048576,  500},
-    {524288,    250}, {262144,    250}, {131072,    250}, {65536,    250}, {32768,    250},
-    {16384,     125}, {8192,      125}, {4096,      125}, {2048,     125}, {1024,     300},
-    {512,         0}, {256,         0}, {128,         0}, {64,         0}, {32,         0},
-    {16,          0}, {8,           0}, {4,           0}, {2,          0}, {1,          0},
-    {0, 0}
-};
-
-static std::unordered_map<unsigned int, int> black_pawn_heuristic = {
-    //Promoted Pawns
-    {1610612736, -20}, {1342177280, -10}, {1207959552, -5}, {1140850688, -10}, {1107296256, -20},
-    {1090519040, -10}, {1082130432,   5}, {1077936128,  5}, {1075838976,   5}, {1074790400, -10},
-    {1074266112,   0}, {1074003968,   5}, {1073872896,  5}, {1073807360,   5}, {1073774592,   0},
-    {1073758208, -10}, {1073750016,   5}, {1073745920,  5}, {1073743872,   5}, {1073742848, -10},
-    {1073742336, -10}, {1073742080,   0}, {1073741952,  0}, {1073741888,   0}, {1073741856, -10},
-    {1073741840, -20}, {1073741832, -10}, {1073741828, -5}, {1073741826, -10}, {1073741825, -20},
-
-    // Regular Pawns
-    {536870912, 0}, {268435456, 0}, {134217728, 0}, {67108864, 0}, {33554432, 0},
-    {16777216,  0}, {8388608,   0}, {4194304,   0}, {2097152,  0}, {1048576,  0},
-    {524288,  125}, {262144,  125}, {131072,  300}, {65536,  125}, {32768,  125},
-    {16384,   250}, {8192,    250}, {4096,    250}, {2048,   250}, {1024,   250},
-    {512,     500}, {256,     500}, {128,     500}, {64,     500}, {32,     500},
-    {16,      900}, {8,       900}, {4,       900}, {2,      900}, {1,      900},
-    {0, 0}
-};
-
-static std::unordered_map<unsigned int, int> begin_white_knight_heuristic = {
-    {536870912, 0}, {268435456, 0}, {134217728, 0}, {67108864, 0}, {33554432, 0},
-    {16777216,  0}, {8388608,   0}, {4194304,   0}, {2097152,  0}, {1048576,  0},
-    {524288,    0}, {262144,    0}, {131072,    0}, {65536,    0}, {32768,    0},
-    {16384,  -200}, {8192,      0}, {4096,   -200}, {2048,     0}, {1024,     0},
-    {512,       0}, {256,       0}, {128,       0}, {64,       0}, {32,       0},
-    {16,        0}, {8,         0}, {4,         0}, {2,        0}, {1,        0},
-    {0, 0}
-};
-
-static std::unordered_map<unsigned int, int> begin_black_knight_heuristic = {
-    {536870912, 0}, {268435456, 0}, {134217728, 0}, {67108864, 0}, {33554432, 0},
-    {16777216,  0}, {8388608,   0}, {4194304,   0}, {2097152,  0}, {1048576,  0},
-    {524288,    0}, {262144,    0}, {131072, -200}, {65536,    0}, {32768, -200},
-    {16384,     0}, {8192,      0}, {4096,      0}, {2048,     0}, {1024,     0},
-    {512,       0}, {256,       0}, {128,       0}, {64,       0}, {32,       0},
-    {16,        0}, {8,         0}, {4,         0}, {2,        0}, {1,        0},
-    {0, 0}
-};
-
-static std::unordered_map<unsigned int, int> middle_white_knight_heuristic = {
-    {536870912, -50}, {268435456, -40}, {134217728, -30}, {67108864, -40}, {33554432, -50},
-    {16777216,  -40}, {8388608,     5}, {4194304,    10}, {2097152,    5}, {1048576,  -40},
-    {524288,    -30}, {262144,     10}, {131072,     20}, {65536,     10}, {32768,    -30},
-    {16384,     -30}, {8192,       10}, {4096,       20}, {2048,      10}, {1024,     -30},
-    {512,       -40}, {256,         5}, {128,        10}, {64,         5}, {32,       -40},
-    {16,        -50}, {8,         -40}, {4,         -30}, {2,        -40}, {1,        -50},
-    {0, 0}
-};
-
-static std::unordered_map<unsigned int, int> middle_black_knight_heuristic = {
-    {536870912, -50}, {268435456, -40}, {134217728, -30}, {67108864, -40}, {33554432, -50},
-    {16777216,  -40}, {8388608,     5}, {4194304,    10}, {2097152,    5}, {1048576,  -40},
-    {524288,    -30}, {262144,     10}, {131072,     20}, {65536,     10}, {32768,    -30},
-    {16384,     -30}, {8192,       10}, {4096,       20}, {2048,      10}, {1024,     -30},
-    {512,       -40}, {256,         5}, {128,        10}, {64,         5}, {32,       -40},
-    {16,        -50}, {8,         -40}, {4,         -30}, {2,        -40}, {1,        -50},
-    {0, 0}
-};
-
-static std::unordered_map<unsigned int, int> white_bishop_heuristic = {
-    {536870912, -200}, {268435456, -150}, {134217728, -100}, {67108864, -150}, {33554432, -200},
-    {16777216,  -150}, {8388608,     50}, {4194304,     50}, {2097152,    50}, {1048576,  -150},
-    {524288,    -100}, {262144,      50}, {131072,     150}, {65536,      50}, {32768,    -100},
-    {16384,     -150}, {8192,       100}, {4096,       100}, {2048,      100}, {1024,     -150},
-    {512,       -100}, {256,          0}, {128,        100}, {64,         00}, {32,       -100},
-    {16,        -250}, {8,         -100}, {4,         -150}, {2,        -100}, {1,        -250},
-    {0, 0}
-};
-
-static std::unordered_map<unsigned int, int> black_bishop_heuristic = {
-    {536870912, -250}, {268435456, -100}, {134217728, -150}, {67108864, -100}, {33554432, -250},
-    {16777216,  -100}, {8388608,     00}, {4194304,    100}, {2097152,    00}, {1048576,  -100},
-    {524288,    -150}, {262144,     100}, {131072,     100}, {65536,     100}, {32768,    -150},
-    {16384,     -100}, {8192,        50}, {4096,       150}, {2048,       50}, {1024,     -100},
-    {512,       -150}, {256,         50}, {128,         50}, {64,         50}, {32,       -150},
-    {16,        -200}, {8,         -150}, {4,         -100}, {2,        -150}, {1,        -200},
-    {0, 0}
-};
-
-static std::unordered_map<unsigned int, int> white_rook_heuristic = {
-    {536870912,   0}, {268435456, 0}, {134217728, 50}, {67108864, 0}, {33554432,   0},
-    {16777216, -100}, {8388608,   0}, {4194304,    0}, {2097152,  0}, {1048576, -100},
-    {524288,   -100}, {262144,    0}, {131072,     0}, {65536,    0}, {32768,   -100},
-    {16384,    -100}, {8192,      0}, {4096,       0}, {2048,     0}, {1024,    -100},
-    {512,        50}, {256,     100}, {128,      100}, {64,     100}, {32,         5},
-    {16,          0}, {8,         0}, {4,          0}, {2,        0}, {1,          0},
-    {0, 0}
-};
-
-static std::unordered_map<unsigned int, int> black_rook_heuristic = {
-    {536870912, 0}, {268435456, 0}, {134217728, 0}, {67108864,  0}, {33554432,  0},
-    {16777216, 50}, {8388608, 100}, {4194304, 100}, {2097152, 100}, {1048576,  50},
-    {524288, -100}, {262144,    0}, {131072,    0}, {65536,     0}, {32768,  -100},
-    {16384,  -100}, {8192,      0}, {4096,      0}, {2048,      0}, {1024,   -100},
-    {512,    -100}, {256,       0}, {128,       0}, {64,        0}, {32,     -100},
-    {16,        0}, {8,         0}, {4,         5}, {2,         0}, {1,         0},
-    {0, 0}
-};
-
-static std::unordered_map<unsigned int, int> white_king_begin_game_heuristic = {
-    {536870912, -300}, {268435456, -300}, {134217728, -300}, {67108864, -300}, {33554432, -300},
-    {16777216,  -300}, {8388608,   -300}, {4194304,   -300}, {2097152,  -300}, {1048576,  -300},
-    {524288,    -300}, {262144,    -300}, {131072,    -300}, {65536,    -300}, {32768,    -300},
-    {16384,     -300}, {8192,      -300}, {4096,      -300}, {2048,     -300}, {1024,     -300},
-    {512,       -300}, {256,       -300}, {128,       -300}, {64,       -300}, {32,       -300},
-    {16,        -300}, {8,         -300}, {4,         -300}, {2,        -300}, {1,           0},
-    {0, 0}
-};
-
-static std::unordered_map<unsigned int, int> black_king_begin_game_heuristic = {
-    {536870912,   0}, {268435456, -300}, {134217728, -300}, {67108864, -300}, {33554432, -300},
-    {16777216, -300}, {8388608,   -300}, {4194304,   -300}, {2097152,  -300}, {1048576,  -300},
-    {524288,   -300}, {262144,    -300}, {131072,    -300}, {65536,    -300}, {32768,    -300},
-    {16384,    -300}, {8192,      -300}, {4096,      -300}, {2048,     -300}, {1024,     -300},
-    {512,      -300}, {256,       -300}, {128,       -300}, {64,       -300}, {32,       -300},
-    {16,       -300}, {8,         -300}, {4,         -300}, {2,        -300}, {1,        -300},
-    {0, 0}
-};
-
-static std::unordered_map<unsigned int, int> white_king_middle_game_heuristic = {
-    {536870912, -30}, {268435456, -40}, {134217728, -50}, {67108864, -40}, {33554432, -30},
-    {16777216,  -30}, {8388608,   -40}, {4194304,   -50}, {2097152,  -40}, {1048576,  -30},
-    {524288,    -30}, {262144,    -40}, {131072,    -50}, {65536,    -40}, {32768,    -30},
-    {16384,     -20}, {8192,      -30}, {4096,      -40}, {2048,     -30}, {1024,     -20},
-    {512,       -10}, {256,       -20}, {128,       -30}, {64,       -20}, {32,       -10},
-    {16,         50}, {8,          40}, {4,           0}, {2,         40}, {1,         50},
-    {0, 0}
-};
-
-static std::unordered_map<unsigned int, int> black_king_middle_game_heuristic = {
-    {536870912, 50}, {268435456, 40}, {134217728, 0}, {67108864, 40}, {33554432, 50},
-    {16777216, -10}, {8388608,  -20}, {4194304, -30}, {2097152, -20}, {1048576, -10},
-    {524288,   -20}, {262144,   -30}, {131072,  -40}, {65536,   -30}, {32768,   -20},
-    {16384,    -30}, {8192,     -40}, {4096,    -50}, {2048,    -40}, {1024,    -30},
-    {512,      -30}, {256,      -40}, {128,     -50}, {64,      -40}, {32,      -30},
-    {16,       -30}, {8,        -40}, {4,       -50}, {2,       -40}, {1,       -30},
-    {0, 0}
-};
-
-static std::unordered_map<unsigned int, int> white_king_end_game_heuristic = {
-    {536870912, -50}, {268435456, -40}, {134217728, -30}, {67108864,  -40}, {33554432,  -50},
-    {16777216,  -30}, {8388608,   -15}, {4194304,     0}, {2097152,   -15}, {1048576,   -30},
-    {524288,    -30}, {262144,     15}, {131072,     40}, {65536,      15}, {32768,     -30},
-    {16384,     -30}, {8192,       15}, {4096,       40}, {2048,       15}, {1024,      -30},
-    {512,       -30}, {256,         0}, {128,         0}, {64,          0}, {32,        -30},
-    {16,        -50}, {8,         -40}, {4,         -30}, {2,         -40}, {1,         -50},
-    {0, 0}
-};
-
-static std::unordered_map<unsigned int, int> black_king_end_game_heuristic = {
-    {536870912, -50}, {268435456, -40}, {134217728, -30}, {67108864,  -40}, {33554432,  -50},
-    {16777216,  -30}, {8388608,     0}, {4194304,     0}, {2097152,     0}, {1048576,   -30},
-    {524288,    -30}, {262144,     15}, {131072,     40}, {65536,      15}, {32768,     -30},
-    {16384,     -30}, {8192,       15}, {4096,       40}, {2048,       15}, {1024,      -30},
-    {512,       -30}, {256,       -15}, {128,         0}, {64,        -15}, {32,        -30},
-    {16,        -50}, {8,         -40}, {4,         -30}, {2,         -40}, {1,         -50},
-    {0, 0}
-};
-
-static Attack_Masks type_to_attack[20] = {
-    KING_ATTACK_MASKS,
-    QUEEN_ATTACK_MASKS,
-    BISHOP_ATTACK_MASKS,
-    KNIGHT_ATTACK_MASKS,
-    ROOK_ATTACK_MASKS,
-    BLACK_PAWN_ATTACK_MASKS,
-    BLACK_PAWN_ATTACK_MASKS,
-    BLACK_PAWN_ATTACK_MASKS,
-    BLACK_PAWN_ATTACK_MASKS,
-    BLACK_PAWN_ATTACK_MASKS,
-    WHITE_PAWN_ATTACK_MASKS,
-    WHITE_PAWN_ATTACK_MASKS,
-    WHITE_PAWN_ATTACK_MASKS,
-    WHITE_PAWN_ATTACK_MASKS,
-    WHITE_PAWN_ATTACK_MASKS,
-    ROOK_ATTACK_MASKS,
-    KNIGHT_ATTACK_MASKS,
-    BISHOP_ATTACK_MASKS,
-    QUEEN_ATTACK_MASKS,
-    KING_ATTACK_MASKS
-};
-
-static Move_Masks type_to_move[20] = {
-    KING_MOVE_MASKS,
-    QUEEN_MOVE_MASKS,
-    BISHOP_MOVE_MASKS,
-    KNIGHT_MOVE_MASKS,
-    ROOK_MOVE_MASKS,
-    BLACK_PAWN_MOVE_MASKS,
-    BLACK_PAWN_MOVE_MASKS,
-    BLACK_PAWN_MOVE_MASKS,
-    BLACK_PAWN_MOVE_MASKS,
-    BLACK_PAWN_MOVE_MASKS,
-    WHITE_PAWN_MOVE_MASKS,
-    WHITE_PAWN_MOVE_MASKS,
-    WHITE_PAWN_MOVE_MASKS,
-    WHITE_PAWN_MOVE_MASKS,
-    WHITE_PAWN_MOVE_MASKS,
-    ROOK_MOVE_MASKS,
-    KNIGHT_MOVE_MASKS,
-    BISHOP_MOVE_MASKS,
-    QUEEN_MOVE_MASKS,
-    KING_MOVE_MASKS
-};
-
-static const int black_on_move_values[20]{
+constexpr int BOARD_WIDTH = 5;
+constexpr int BOARD_HEIGHT = 6;
+constexpr int NUM_SQUARES = BOARD_WIDTH * BOARD_HEIGHT;
+constexpr int NO_SQUARE = NUM_SQUARES;
+
+constexpr unsigned int BOARD_MASK = (1u << NUM_SQUARES) - 1;
+constexpr unsigned int PROMOTED_PAWN = 1u << NUM_SQUARES;
+
+typedef std::array<unsigned int, NUM_SQUARES + 1> Square_Masks;
+typedef std::array<int, NUM_SQUARES + 1> Square_Values;
+
+/**
+ * The movement types used to index the mask tables. A promoted pawn moves
+ * like a queen.
+ */
+enum Piece_Type {
+  KING,
+  QUEEN,
+  BISHOP,
+  KNIGHT,
+  ROOK,
+  BLACK_PAWN,
+  WHITE_PAWN,
+  NUM_PIECE_TYPES
+};
+
+inline constexpr Piece_Type slot_piece_type[20]{
+    KING,        // k
+    QUEEN,       // q
+    BISHOP,      // b
+    KNIGHT,      // n
+    ROOK,        // r
+    BLACK_PAWN,  // p
+    BLACK_PAWN,  // p
+    BLACK_PAWN,  // p
+    BLACK_PAWN,  // p
+    BLACK_PAWN,  // p
+    WHITE_PAWN,  // P
+    WHITE_PAWN,  // P
+    WHITE_PAWN,  // P
+    WHITE_PAWN,  // P
+    WHITE_PAWN,  // P
+    ROOK,        // R
+    KNIGHT,      // N
+    BISHOP,      // B
+    QUEEN,       // Q
+    KING,        // K
+};
+
+/**
+ * Convert a one-hot position (promoted or not) into its square number.
+ *
+ * @param position
+ * @return The index of the set bit, NO_SQUARE if the piece is not on the board.
+ */
+constexpr int to_square(unsigned int position) {
+  return position ? __builtin_ctz(position) : NO_SQUARE;
+}
+
+/**
+ * @param slot The index of the piece in the Board.
+ * @param position The Board word at that index.
+ * @return The movement type of the piece.
+ */
+constexpr int piece_type(int slot, unsigned int position) {
+  return (position & PROMOTED_PAWN) ? QUEEN : slot_piece_type[slot];
+}
+
+/**
+ * White pawns are marked as promoted from the fifth rank up and black pawns
+ * on the first rank.
+ *
+ * @param slot The index of the piece in the Board.
+ * @param end_pos The one-hot destination of the piece.
+ * @return True if a pawn moving to end_pos becomes a promoted pawn.
+ */
+constexpr bool promotes(int slot, unsigned int end_pos) {
+  return 4 < slot && slot < 15 && (end_pos > (1u << 19) || end_pos < (1u << 5));
+}
+
+/*
+ * Board geometry. Ranks count up from 0 (rank 1, white's back rank) and files
+ * count up from 0 (file a).
+ */
+
+constexpr int square_rank(int square) {
+  return square / BOARD_WIDTH;
+}
+
+constexpr int square_file(int square) {
+  return BOARD_WIDTH - 1 - square % BOARD_WIDTH;
+}
+
+constexpr bool on_board(int rank, int file) {
+  return 0 <= rank && rank < BOARD_HEIGHT && 0 <= file && file < BOARD_WIDTH;
+}
+
+constexpr unsigned int square_bit(int rank, int file) {
+  return 1u << (rank * BOARD_WIDTH + BOARD_WIDTH - 1 - file);
+}
+
+struct Offset {
+  int rank;
+  int file;
+};
+
+inline constexpr Offset ORTHOGONAL[4]{{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+inline constexpr Offset DIAGONAL[4]{{1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+inline constexpr Offset ALL_DIRECTIONS[8]{{1, 0}, {-1, 0}, {0, 1}, {0, -1}, {1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+inline constexpr Offset KNIGHT_JUMPS[8]{{1, 2}, {2, 1}, {-1, 2}, {-2, 1}, {1, -2}, {2, -1}, {-1, -2}, {-2, -1}};
+inline constexpr Offset BLACK_PAWN_PUSH[1]{{-1, 0}};
+inline constexpr Offset BLACK_PAWN_CAPTURES[2]{{-1, 1}, {-1, -1}};
+inline constexpr Offset WHITE_PAWN_PUSH[1]{{1, 0}};
+inline constexpr Offset WHITE_PAWN_CAPTURES[2]{{1, 1}, {1, -1}};
+
+/**
+ * @return The squares one step away from square in each of the given directions.
+ */
+template<int N>
+constexpr unsigned int step_mask(int square, const Offset (&offsets)[N]) {
+  unsigned int result = 0;
+  for (const Offset &offset : offsets) {
+    int rank = square_rank(square) + offset.rank;
+    int file = square_file(square) + offset.file;
+    if (on_board(rank, file)) {
+      result |= square_bit(rank, file);
+    }
+  }
+  return result;
+}
+
+/**
+ * @return The squares from square (exclusive) to the edge of the board in the given direction.
+ */
+constexpr unsigned int ray_mask(int square, Offset direction) {
+  unsigned int result = 0;
+  int rank = square_rank(square) + direction.rank;
+  int file = square_file(square) + direction.file;
+  for (; on_board(rank, file); rank += direction.rank, file += direction.file) {
+    result |= square_bit(rank, file);
+  }
+  return result;
+}
+
+template<int N>
+constexpr unsigned int slide_mask(int square, const Offset (&directions)[N]) {
+  unsigned int result = 0;
+  for (const Offset &direction : directions) {
+    result |= ray_mask(square, direction);
+  }
+  return result;
+}
+
+/**
+ * Minichess bishops capture along the diagonals but may also make a single,
+ * non-capturing step along a rank or file.
+ *
+ * @param type
+ * @param attack True for squares that can be attacked, false for squares that can be moved to.
+ * @param square
+ * @return The squares a piece of the given type on square could reach on an empty board.
+ */
+constexpr unsigned int piece_mask(int type, bool attack, int square) {
+  switch (type) {
+    case KING:
+      return step_mask(square, ALL_DIRECTIONS);
+    case QUEEN:
+      return slide_mask(square, ALL_DIRECTIONS);
+    case BISHOP:
+      return slide_mask(square, DIAGONAL) | (attack ? 0 : step_mask(square, ORTHOGONAL));
+    case KNIGHT:
+      return step_mask(square, KNIGHT_JUMPS);
+    case ROOK:
+      return slide_mask(square, ORTHOGONAL);
+    case BLACK_PAWN:
+      return attack ? step_mask(square, BLACK_PAWN_CAPTURES) : step_mask(square, BLACK_PAWN_PUSH);
+    case WHITE_PAWN:
+      return attack ? step_mask(square, WHITE_PAWN_CAPTURES) : step_mask(square, WHITE_PAWN_PUSH);
+    default:
+      return 0;
+  }
+}
+
+constexpr std::array<Square_Masks, NUM_PIECE_TYPES> generate_piece_masks(bool attack) {
+  std::array<Square_Masks, NUM_PIECE_TYPES> result{};
+  for (int type = 0; type < NUM_PIECE_TYPES; ++type) {
+    for (int square = 0; square < NUM_SQUARES; ++square) {
+      result[type][square] = piece_mask(type, attack, square);
+    }
+  }
+  return result;
+}
+
+constexpr std::array<Square_Masks, 8> generate_ray_masks() {
+  std::array<Square_Masks, 8> result{};
+  for (int direction = 0; direction < 8; ++direction) {
+    for (int square = 0; square < NUM_SQUARES; ++square) {
+      result[direction][square] = ray_mask(square, ALL_DIRECTIONS[direction]);
+    }
+  }
+  return result;
+}
+
+/**
+ * A step along a rank changes the square number by BOARD_WIDTH and a step
+ * along a file changes it by one in the opposite direction, so a ray heads
+ * towards higher square numbers if it goes up the board, or straight along
+ * the rank towards file a.
+ */
+constexpr bool ray_increases(Offset direction) {
+  return direction.rank > 0 || (direction.rank == 0 && direction.file < 0);
+}
+
+/**
+ * RAY_MASKS[direction][square] is every square from square (exclusive) to the
+ * edge of the board in ALL_DIRECTIONS[direction]. The first four directions
+ * are orthogonal and the last four diagonal.
+ */
+inline constexpr std::array<Square_Masks, 8> RAY_MASKS = generate_ray_masks();
+
+inline constexpr bool RAY_INCREASES[8]{
+    ray_increases(ALL_DIRECTIONS[0]), ray_increases(ALL_DIRECTIONS[1]),
+    ray_increases(ALL_DIRECTIONS[2]), ray_increases(ALL_DIRECTIONS[3]),
+    ray_increases(ALL_DIRECTIONS[4]), ray_increases(ALL_DIRECTIONS[5]),
+    ray_increases(ALL_DIRECTIONS[6]), ray_increases(ALL_DIRECTIONS[7]),
+};
+
+/**
+ * All of the squares a piece of a given type on a given square could reach on
+ * an empty board. Attacks must end on an opponent, moves must end on an empty
+ * square. Neither includes the starting square.
+ */
+inline constexpr std::array<Square_Masks, NUM_PIECE_TYPES> ATTACK_MASKS = generate_piece_masks(true);
+
+inline constexpr std::array<Square_Masks, NUM_PIECE_TYPES> MOVE_MASKS = generate_piece_masks(false);
+
+/**
+ * The squares a slider on square reaches in one direction: the ray up to and
+ * including the first occupied square. The first blocker is the lowest set
+ * bit of an increasing ray and the highest set bit of a decreasing one, and
+ * everything behind it is the blocker's own ray in the same direction.
+ *
+ * @param direction An index into ALL_DIRECTIONS.
+ * @param square
+ * @param occupancy Every occupied square.
+ */
+inline unsigned int ray_attacks(int direction, int square, unsigned int occupancy) {
+  unsigned int ray = RAY_MASKS[direction][square];
+  unsigned int blockers = ray & occupancy;
+  if (blockers) {
+    int blocker = RAY_INCREASES[direction] ? __builtin_ctz(blockers) : 31 - __builtin_clz(blockers);
+    ray ^= RAY_MASKS[direction][blocker];
+  }
+  return ray;
+}
+
+inline unsigned int orthogonal_attacks(int square, unsigned int occupancy) {
+  return ray_attacks(0, square, occupancy) | ray_attacks(1, square, occupancy)
+         | ray_attacks(2, square, occupancy) | ray_attacks(3, square, occupancy);
+}
+
+inline unsigned int diagonal_attacks(int square, unsigned int occupancy) {
+  return ray_attacks(4, square, occupancy) | ray_attacks(5, square, occupancy)
+         | ray_attacks(6, square, occupancy) | ray_attacks(7, square, occupancy);
+}
+
+/**
+ * The squares a piece can reach given the pieces on the board. Sliders stop
+ * at the first piece in each direction, which is included so that it can be
+ * captured; callers mask the result with the opponents or the empty squares.
+ * Everything else reads straight out of ATTACK_MASKS and MOVE_MASKS.
+ *
+ * @param type The movement type of the piece, see piece_type.
+ * @param attack True for squares that can be attacked, false for squares that can be moved to.
+ * @param square The square of the piece, NO_SQUARE if it has been captured.
+ * @param occupancy Every occupied square.
+ */
+inline unsigned int piece_reach(int type, bool attack, int square, unsigned int occupancy) {
+  switch (type) {
+    case QUEEN:
+      return orthogonal_attacks(square, occupancy) | diagonal_attacks(square, occupancy);
+    case ROOK:
+      return orthogonal_attacks(square, occupancy);
+    case BISHOP:
+      // The single orthogonal steps a bishop may move can never be blocked
+      return attack ? diagonal_attacks(square, occupancy)
+                    : diagonal_attacks(square, occupancy) | (MOVE_MASKS[BISHOP][square] & ~ATTACK_MASKS[BISHOP][square]);
+    default:
+      return attack ? ATTACK_MASKS[type][square] : MOVE_MASKS[type][square];
+  }
+}
+
+typedef std::array<char, 3> Square_Name;
+
+constexpr std::array<Square_Name, NUM_SQUARES> generate_square_names() {
+  std::array<Square_Name, NUM_SQUARES> result{};
+  for (int square = 0; square < NUM_SQUARES; ++square) {
+    result[square] = {static_cast<char>('a' + square_file(square)), static_cast<char>('1' + square_rank(square)), '\0'};
+  }
+  return result;
+}
+
+/**
+ * "a6", "b6", ... "e1" indexed by square. Use .data() for the C string.
+ */
+inline constexpr std::array<Square_Name, NUM_SQUARES> SQUARE_NAMES = generate_square_names();
+
+typedef std::array<char, 6> Move_Name;
+
+constexpr std::array<std::array<Move_Name, NUM_SQUARES>, NUM_SQUARES> generate_move_string_table() {
+  std::array<std::array<Move_Name, NUM_SQUARES>, NUM_SQUARES> result{};
+  for (int from = 0; from < NUM_SQUARES; ++from) {
+    for (int to = 0; to < NUM_SQUARES; ++to) {
+      result[from][to] = {SQUARE_NAMES[from][0], SQUARE_NAMES[from][1], '-',
+                          SQUARE_NAMES[to][0], SQUARE_NAMES[to][1], '\0'};
+    }
+  }
+  return result;
+}
+
+/**
+ * MOVE_STRINGS[from][to] is the "a1-b2" string the server expects. The
+ * search works on encoded Moves and only looks a string up here once it has
+ * settled on a move to send back.
+ */
+inline constexpr std::array<std::array<Move_Name, NUM_SQUARES>, NUM_SQUARES> MOVE_STRINGS = generate_move_string_table();
+
+/**
+ * The version of eval. Bump it whenever eval can return a different value
+ * for some state, whether through these tables or Player::eval itself:
+ * persistent transposition tables hold values from eval and are cleared
+ * when it changes.
+ *
+ * 1: material, piece-square, mobility and the doubled pawn term
+ * 2: the pawn structure terms of Player::calculate_pawn_structure_value
+ */
+#define EVAL_VERSION 2
+
+/**
+ * Heuristic tables are written the way the board is drawn, a6 first and e1
+ * last. This lays them out by square number.
+ *
+ * @param layout The value of a piece on each square, in board order.
+ * @param captured The value of the piece once it has been captured.
+ * @return The values indexed by square, with captured at NO_SQUARE.
+ */
+constexpr Square_Values from_board_layout(const int (&layout)[NUM_SQUARES], int captured = 0) {
+  Square_Values result{};
+  for (int i = 0; i < NUM_SQUARES; ++i) {
+    result[NUM_SQUARES - 1 - i] = layout[i];
+  }
+  result[NO_SQUARE] = captured;
+  return result;
+}
+
+inline constexpr Square_Values begin_white_queen_heuristic = from_board_layout({
+     -200,  -200,  -200,  -200,  -200,
+     -200,  -200,  -200,  -200,  -200,
+     -200,  -200,  -200,  -200,  -200,
+     -200,  -200,  -200,  -200,  -200,
+     -200,  -200,  -200,  -200,   200,
+        0,     0,     0,     0,     0
+}, -5000);
+
+inline constexpr Square_Values begin_black_queen_heuristic = from_board_layout({
+        0,     0,     0,     0,     0,
+      200,  -200,  -200,  -200,  -200,
+     -200,  -200,  -200,  -200,  -200,
+     -200,  -200,  -200,  -200,  -200,
+     -200,  -200,  -200,  -200,  -200,
+     -200,  -200,  -200,  -200,  -200
+}, -5000);
+
+inline constexpr Square_Values white_queen_heuristic = from_board_layout({
+      -20,   -10,    -5,   -10,   -20,
+      -10,     0,     0,     0,   -10,
+      -10,     5,     5,     5,   -10,
+        0,     5,     5,     5,     0,
+      -10,     5,     5,     5,   -10,
+      -20,   -10,    -5,   -10,   -20
+});
+
+inline constexpr Square_Values black_queen_heuristic = from_board_layout({
+      -20,   -10,    -5,   -10,   -20,
+      -10,     5,     5,     5,   -10,
+        0,     5,     5,     5,     0,
+      -10,     5,     5,     5,   -10,
+      -10,     0,     0,     0,   -10,
+      -20,   -10,    -5,   -10,   -20
+});
+
+inline constexpr Square_Values white_pawn_heuristic = from_board_layout({
+      900,   900,   900,   900,   900,
+      500,   500,   500,   500,   500,
+      250,   250,   250,   250,   250,
+      125,   125,   125,   125,   300,
+        0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0
+});
+
+inline constexpr Square_Values black_pawn_heuristic = from_board_layout({
+        0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,
+      125,   125,   300,   125,   125,
+      250,   250,   250,   250,   250,
+      500,   500,   500,   500,   500,
+      900,   900,   900,   900,   900
+});
+
+inline constexpr Square_Values begin_white_knight_heuristic = from_board_layout({
+        0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,
+     -200,     0,  -200,     0,     0,
+        0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0
+});
+
+inline constexpr Square_Values begin_black_knight_heuristic = from_board_layout({
+        0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,
+        0,     0,  -200,     0,  -200,
+        0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0
+});
+
+inline constexpr Square_Values middle_white_knight_heuristic = from_board_layout({
+      -50,   -40,   -30,   -40,   -50,
+      -40,     5,    10,     5,   -40,
+      -30,    10,    20,    10,   -30,
+      -30,    10,    20,    10,   -30,
+      -40,     5,    10,     5,   -40,
+      -50,   -40,   -30,   -40,   -50
+});
+
+inline constexpr Square_Values middle_black_knight_heuristic = from_board_layout({
+      -50,   -40,   -30,   -40,   -50,
+      -40,     5,    10,     5,   -40,
+      -30,    10,    20,    10,   -30,
+      -30,    10,    20,    10,   -30,
+      -40,     5,    10,     5,   -40,
+      -50,   -40,   -30,   -40,   -50
+});
+
+inline constexpr Square_Values white_bishop_heuristic = from_board_layout({
+     -200,  -150,  -100,  -150,  -200,
+     -150,    50,    50,    50,  -150,
+     -100,    50,   150,    50,  -100,
+     -150,   100,   100,   100,  -150,
+     -100,     0,   100,     0,  -100,
+     -250,  -100,  -150,  -100,  -250
+});
+
+inline constexpr Square_Values black_bishop_heuristic = from_board_layout({
+     -250,  -100,  -150,  -100,  -250,
+     -100,     0,   100,     0,  -100,
+     -150,   100,   100,   100,  -150,
+     -100,    50,   150,    50,  -100,
+     -150,    50,    50,    50,  -150,
+     -200,  -150,  -100,  -150,  -200
+});
+
+inline constexpr Square_Values white_rook_heuristic = from_board_layout({
+        0,     0,    50,     0,     0,
+     -100,     0,     0,     0,  -100,
+     -100,     0,     0,     0,  -100,
+     -100,     0,     0,     0,  -100,
+       50,   100,   100,   100,     5,
+        0,     0,     0,     0,     0
+});
+
+inline constexpr Square_Values black_rook_heuristic = from_board_layout({
+        0,     0,     0,     0,     0,
+       50,   100,   100,   100,    50,
+     -100,     0,     0,     0,  -100,
+     -100,     0,     0,     0,  -100,
+     -100,     0,     0,     0,  -100,
+        0,     0,     5,     0,     0
+});
+
+inline constexpr Square_Values white_king_begin_game_heuristic = from_board_layout({
+     -300,  -300,  -300,  -300,  -300,
+     -300,  -300,  -300,  -300,  -300,
+     -300,  -300,  -300,  -300,  -300,
+     -300,  -300,  -300,  -300,  -300,
+     -300,  -300,  -300,  -300,  -300,
+     -300,  -300,  -300,  -300,     0
+});
+
+inline constexpr Square_Values black_king_begin_game_heuristic = from_board_layout({
+        0,  -300,  -300,  -300,  -300,
+     -300,  -300,  -300,  -300,  -300,
+     -300,  -300,  -300,  -300,  -300,
+     -300,  -300,  -300,  -300,  -300,
+     -300,  -300,  -300,  -300,  -300,
+     -300,  -300,  -300,  -300,  -300
+});
+
+inline constexpr Square_Values white_king_middle_game_heuristic = from_board_layout({
+      -30,   -40,   -50,   -40,   -30,
+      -30,   -40,   -50,   -40,   -30,
+      -30,   -40,   -50,   -40,   -30,
+      -20,   -30,   -40,   -30,   -20,
+      -10,   -20,   -30,   -20,   -10,
+       50,    40,     0,    40,    50
+});
+
+inline constexpr Square_Values black_king_middle_game_heuristic = from_board_layout({
+       50,    40,     0,    40,    50,
+      -10,   -20,   -30,   -20,   -10,
+      -20,   -30,   -40,   -30,   -20,
+      -30,   -40,   -50,   -40,   -30,
+      -30,   -40,   -50,   -40,   -30,
+      -30,   -40,   -50,   -40,   -30
+});
+
+inline constexpr Square_Values white_king_end_game_heuristic = from_board_layout({
+      -50,   -40,   -30,   -40,   -50,
+      -30,   -15,     0,   -15,   -30,
+      -30,    15,    40,    15,   -30,
+      -30,    15,    40,    15,   -30,
+      -30,     0,     0,     0,   -30,
+      -50,   -40,   -30,   -40,   -50
+});
+
+inline constexpr Square_Values black_king_end_game_heuristic = from_board_layout({
+      -50,   -40,   -30,   -40,   -50,
+      -30,     0,     0,     0,   -30,
+      -30,    15,    40,    15,   -30,
+      -30,    15,    40,    15,   -30,
+      -30,   -15,     0,   -15,   -30,
+      -50,   -40,   -30,   -40,   -50
+});
+
+/**
+ * The heuristic value of each piece on each square, for the beginning
+ * (move <= 10), middle (move <= 25) and end of the game, indexed by the
+ * piece's index in the Board. The NO_SQUARE entry is the value of a piece
+ * that has been captured.
+ */
+inline constexpr std::array<std::array<Square_Values, 20>, 3> piece_square_values{{
+    {
+        black_king_begin_game_heuristic, begin_black_queen_heuristic, black_bishop_heuristic, begin_black_knight_heuristic, black_rook_heuristic,
+        black_pawn_heuristic, black_pawn_heuristic, black_pawn_heuristic, black_pawn_heuristic, black_pawn_heuristic,
+        white_pawn_heuristic, white_pawn_heuristic, white_pawn_heuristic, white_pawn_heuristic, white_pawn_heuristic,
+        white_rook_heuristic, begin_white_knight_heuristic, white_bishop_heuristic, begin_white_queen_heuristic, white_king_begin_game_heuristic,
+    },
+    {
+        black_king_middle_game_heuristic, black_queen_heuristic, black_bishop_heuristic, middle_black_knight_heuristic, black_rook_heuristic,
+        black_pawn_heuristic, black_pawn_heuristic, black_pawn_heuristic, black_pawn_heuristic, black_pawn_heuristic,
+        white_pawn_heuristic, white_pawn_heuristic, white_pawn_heuristic, white_pawn_heuristic, white_pawn_heuristic,
+        white_rook_heuristic, middle_white_knight_heuristic, white_bishop_heuristic, white_queen_heuristic, white_king_middle_game_heuristic,
+    },
+    {
+        black_king_end_game_heuristic, black_queen_heuristic, black_bishop_heuristic, middle_black_knight_heuristic, black_rook_heuristic,
+        black_pawn_heuristic, black_pawn_heuristic, black_pawn_heuristic, black_pawn_heuristic, black_pawn_heuristic,
+        white_pawn_heuristic, white_pawn_heuristic, white_pawn_heuristic, white_pawn_heuristic, white_pawn_heuristic,
+        white_rook_heuristic, middle_white_knight_heuristic, white_bishop_heuristic, white_queen_heuristic, white_king_end_game_heuristic,
+    },
+}};
+
+/**
+ * The heuristic value of a promoted pawn on each square, black then white.
+ * Promoted pawns move like queens and use the queen table in every phase of
+ * the game.
+ */
+inline constexpr std::array<Square_Values, 2> promoted_pawn_square_values{{
+    black_queen_heuristic,
+    white_queen_heuristic,
+}};
+
+/**
+ * @param move_number
+ * @return The index of the phase of the game in piece_square_values.
+ */
+constexpr int game_phase(unsigned int move_number) {
+  return (move_number <= 10) ? 0 : (move_number <= 25) ? 1 : 2;
+}
+
+/**
+ * @param phase The phase of the game, see game_phase.
+ * @param slot The index of the piece in the Board.
+ * @param position The Board word at that index.
+ * @return The heuristic value of the piece where it stands.
+ */
+constexpr int piece_square_value(int phase, int slot, unsigned int position) {
+  return (position & PROMOTED_PAWN) ? promoted_pawn_square_values[slot >= 10][to_square(position)]
+                                    : piece_square_values[phase][slot][to_square(position)];
+}
+
+/*
+ * Pawn structure. A side loses DOUBLED_PAWN_VALUE for every file with more
+ * than one of its pawns and ISOLATED_PAWN_VALUE for every pawn with none of
+ * its pawns on the files next to it, and gains PASSED_PAWN_VALUES, by how
+ * far the pawn has come from its own back rank, for every pawn with no
+ * enemy pawn in front of it on its own file or the files next to it.
+ * Promoted pawns are queens and don't count.
+ */
+
+#define DOUBLED_PAWN_VALUE 20
+#define ISOLATED_PAWN_VALUE 15
+
+inline constexpr int PASSED_PAWN_VALUES[BOARD_HEIGHT]{0, 10, 25, 50, 50, 50};
+
+typedef std::array<unsigned int, BOARD_WIDTH> File_Masks;
+
+constexpr File_Masks generate_file_masks(bool adjacent) {
+  File_Masks result{};
+  for (int file = 0; file < BOARD_WIDTH; ++file) {
+    for (int rank = 0; rank < BOARD_HEIGHT; ++rank) {
+      for (int f = file - 1; f <= file + 1; ++f) {
+        if (on_board(rank, f) && (f == file) != adjacent) {
+          result[file] |= square_bit(rank, f);
+        }
+      }
+    }
+  }
+  return result;
+}
+
+inline constexpr File_Masks FILE_MASKS = generate_file_masks(false);
+
+inline constexpr File_Masks ADJACENT_FILE_MASKS = generate_file_masks(true);
+
+/**
+ * @param white
+ * @return The squares in front of a pawn of that color on its own file and
+ *         the files next to it, indexed by square.
+ */
+constexpr Square_Masks generate_passed_pawn_masks(bool white) {
+  Square_Masks result{};
+  for (int square = 0; square < NUM_SQUARES; ++square) {
+    int file = square_file(square);
+    for (int rank = 0; rank < BOARD_HEIGHT; ++rank) {
+      if (white ? rank <= square_rank(square) : rank >= square_rank(square)) {
+        continue;
+      }
+      for (int f = file - 1; f <= file + 1; ++f) {
+        if (on_board(rank, f)) {
+          result[square] |= square_bit(rank, f);
+        }
+      }
+    }
+  }
+  return result;
+}
+
+/**
+ * Black then white, like promoted_pawn_square_values.
+ */
+inline constexpr std::array<Square_Masks, 2> PASSED_PAWN_MASKS{{
+    generate_passed_pawn_masks(false),
+    generate_passed_pawn_masks(true),
+}};
+
+inline constexpr int black_on_move_values[20]{
     10000,  // MY KING
     900,    // MY QUEEN
     320,    // MY BISHOP
@@ -2724,7 +710,7 @@ static const int black_on_move_values[20]{
     -10000  // OPPONENT KING
 };
 
-static const int white_on_move_values[20]{
+inline constexpr int white_on_move_values[20]{
     -10000,  // OPPONENT KING
     -900,    // OPPONENT QUEEN
     -320,    // OPPONENT BISHOP
@@ -2747,7 +733,33 @@ static const int white_on_move_values[20]{
     10000  // MY KING
 };
 
-static const int piece_type_zobrist_index[20]{
+/**
+ * The rank of each movement type when ordering captures, most valuable last.
+ * A capture scores CAPTURE_ORDER[victim] * 8 - CAPTURE_ORDER[attacker].
+ */
+inline constexpr int CAPTURE_ORDER[NUM_PIECE_TYPES]{
+    5,  // KING
+    4,  // QUEEN
+    2,  // BISHOP
+    1,  // KNIGHT
+    3,  // ROOK
+    0,  // BLACK_PAWN
+    0,  // WHITE_PAWN
+};
+
+/**
+ * @param color The PLAYER ON MOVE value whose table to use {1 WHITE, 2 BLACK}.
+ * @param slot The index of the piece in the Board.
+ * @param position The Board word at that index.
+ * @return The material value of the piece, 0 once it has been captured.
+ *         Promoted pawns count as queens of their color.
+ */
+constexpr int piece_material_value(unsigned int color, int slot, unsigned int position) {
+  const int *values = (color == 1) ? white_on_move_values : black_on_move_values;
+  return !position ? 0 : (position & PROMOTED_PAWN) ? values[(slot < 10) ? 1 : 18] : values[slot];
+}
+
+inline constexpr int piece_type_zobrist_index[20]{
     0,  // k
     1,  // q
     2,  // b
@@ -2770,144 +782,25 @@ static const int piece_type_zobrist_index[20]{
     11, // K
 };
 
-static std::unordered_map<unsigned int, int> begin_heuristic_dispatch[20] = {
-    black_king_begin_game_heuristic,
-    begin_black_queen_heuristic,
-    black_bishop_heuristic,
-    begin_black_knight_heuristic,
-    black_rook_heuristic,
-    black_pawn_heuristic,
-    black_pawn_heuristic,
-    black_pawn_heuristic,
-    black_pawn_heuristic,
-    black_pawn_heuristic,
-    white_pawn_heuristic,
-    white_pawn_heuristic,
-    white_pawn_heuristic,
-    white_pawn_heuristic,
-    white_pawn_heuristic,
-    white_rook_heuristic,
-    begin_white_knight_heuristic,
-    white_bishop_heuristic,
-    begin_white_queen_heuristic,
-    white_king_begin_game_heuristic,
-};
-
-static std::unordered_map<unsigned int, int> middle_heuristic_dispatch[20] = {
-    black_king_middle_game_heuristic,
-    black_queen_heuristic,
-    black_bishop_heuristic,
-    middle_black_knight_heuristic,
-    black_rook_heuristic,
-    black_pawn_heuristic,
-    black_pawn_heuristic,
-    black_pawn_heuristic,
-    black_pawn_heuristic,
-    black_pawn_heuristic,
-    white_pawn_heuristic,
-    white_pawn_heuristic,
-    white_pawn_heuristic,
-    white_pawn_heuristic,
-    white_pawn_heuristic,
-    white_rook_heuristic,
-    middle_white_knight_heuristic,
-    white_bishop_heuristic,
-    white_queen_heuristic,
-    white_king_middle_game_heuristic,
-};
-
-static std::unordered_map<unsigned int, int> end_heuristic_dispatch[20] = {
-    black_king_end_game_heuristic,
-    black_queen_heuristic,
-    black_bishop_heuristic,
-    middle_black_knight_heuristic,
-    black_rook_heuristic,
-    black_pawn_heuristic,
-    black_pawn_heuristic,
-    black_pawn_heuristic,
-    black_pawn_heuristic,
-    black_pawn_heuristic,
-    white_pawn_heuristic,
-    white_pawn_heuristic,
-    white_pawn_heuristic,
-    white_pawn_heuristic,
-    white_pawn_heuristic,
-    white_rook_heuristic,
-    middle_white_knight_heuristic,
-    white_bishop_heuristic,
-    white_queen_heuristic,
-    white_king_end_game_heuristic,
-};
-
-static std::unordered_map<unsigned int, unsigned int> combined_attack_dispatch[20] = {
-    KING_ATTACK_MASKS_COMBINED,
-    QUEEN_ATTACK_MASKS_COMBINED,
-    BISHOP_ATTACK_MASKS_COMBINED,
-    KNIGHT_ATTACK_MASKS_COMBINED,
-    ROOK_ATTACK_MASKS_COMBINED,
-    BLACK_PAWN_ATTACK_MASKS_COMBINED,
-    BLACK_PAWN_ATTACK_MASKS_COMBINED,
-    BLACK_PAWN_ATTACK_MASKS_COMBINED,
-    BLACK_PAWN_ATTACK_MASKS_COMBINED,
-    BLACK_PAWN_ATTACK_MASKS_COMBINED,
-    WHITE_PAWN_ATTACK_MASKS_COMBINED,
-    WHITE_PAWN_ATTACK_MASKS_COMBINED,
-    WHITE_PAWN_ATTACK_MASKS_COMBINED,
-    WHITE_PAWN_ATTACK_MASKS_COMBINED,
-    WHITE_PAWN_ATTACK_MASKS_COMBINED,
-    ROOK_ATTACK_MASKS_COMBINED,
-    KNIGHT_ATTACK_MASKS_COMBINED,
-    BISHOP_ATTACK_MASKS_COMBINED,
-    QUEEN_ATTACK_MASKS_COMBINED,
-    KING_ATTACK_MASKS_COMBINED
-};
-
-static std::unordered_map<unsigned int, unsigned int> combined_move_dispatch[20] = {
-    KING_MOVE_MASKS_COMBINED,
-    QUEEN_MOVE_MASKS_COMBINED,
-    BISHOP_MOVE_MASKS_COMBINED,
-    KNIGHT_MOVE_MASKS_COMBINED,
-    ROOK_MOVE_MASKS_COMBINED,
-    BLACK_PAWN_MOVE_MASKS_COMBINED,
-    BLACK_PAWN_MOVE_MASKS_COMBINED,
-    BLACK_PAWN_MOVE_MASKS_COMBINED,
-    BLACK_PAWN_MOVE_MASKS_COMBINED,
-    BLACK_PAWN_MOVE_MASKS_COMBINED,
-    WHITE_PAWN_MOVE_MASKS_COMBINED,
-    WHITE_PAWN_MOVE_MASKS_COMBINED,
-    WHITE_PAWN_MOVE_MASKS_COMBINED,
-    WHITE_PAWN_MOVE_MASKS_COMBINED,
-    WHITE_PAWN_MOVE_MASKS_COMBINED,
-    ROOK_MOVE_MASKS_COMBINED,
-    KNIGHT_MOVE_MASKS_COMBINED,
-    BISHOP_MOVE_MASKS_COMBINED,
-    QUEEN_MOVE_MASKS_COMBINED,
-    KING_MOVE_MASKS_COMBINED
+/**
+ * The piece_type_zobrist_index of a promoted pawn, black then white.
+ */
+inline constexpr int promoted_zobrist_index[2]{
+    1,  // q
+    10, // Q
 };
 
-static std::unordered_map<unsigned int, unsigned int> my_player_index{
-    {1, 10},
-    {2, 0}
-};
+/**
+ * Lookups keyed by the PLAYER ON MOVE word {1 WHITE, 2 BLACK}. Index 0 is unused.
+ */
+inline constexpr unsigned int my_player_index[3]{0, 10, 0};
 
-static std::unordered_map<unsigned int, unsigned int> opponent_player_index{
-    {1, 0},
-    {2, 10}
-};
+inline constexpr unsigned int opponent_player_index[3]{0, 0, 10};
 
-static std::unordered_map<unsigned int, unsigned int> opponent{
-    {1, 2},
-    {2, 1}
-};
+inline constexpr unsigned int opponent[3]{0, 2, 1};
 
-static std::unordered_map<unsigned int, unsigned int> my_king_index{
-    {1, 19},
-    {2, 0}
-};
+inline constexpr unsigned int my_king_index[3]{0, 19, 0};
 
-static std::unordered_map<unsigned int, unsigned int> opponent_king_index{
-    {1, 0},
-    {2, 19}
-};
+inline constexpr unsigned int opponent_king_index[3]{0, 0, 19};
 
-#endif  // BITBOARD_TABLES_H
\ No newline at end of file
+#endif //BITBOARD_TABLES_H
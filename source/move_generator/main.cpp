@@ -2,8 +2,14 @@
  * The main function for the back end.
  * Mike Lane
  *
+ *     move_generator [--hash-mb MB] [--hash-file PATH]
+ *
+ * --hash-mb sets the size of the transposition table. --hash-file keeps it
+ * in a file, so that it carries over from one game to the next.
  */
 
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <zmq.hpp>
 #include <sstream>
@@ -15,8 +21,20 @@
 #include "AB_ID_Player.h"
 #include "AB_ID_TT_Player.h"
 
-int main() {
+int main(int argc, char **argv) {
   int exit_code = 0;
+  std::size_t hash_mb = TTABLE_DEFAULT_MB;
+  std::string hash_file;
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--hash-mb") && i + 1 < argc) {
+      hash_mb = std::strtoul(argv[++i], nullptr, 10);
+    } else if (!strcmp(argv[i], "--hash-file") && i + 1 < argc) {
+      hash_file = argv[++i];
+    } else {
+      std::cerr << "usage: move_generator [--hash-mb MB] [--hash-file PATH]" << std::endl;
+      return 1;
+    }
+  }
 
   // zeromq boilerplate.
   zmq::context_t context(1);
@@ -70,7 +88,7 @@ int main() {
     player = new AB_ID_Player();
     std::cerr << "Created a new AB_ID_Player" << std::endl;
   } else if (player_type == "5") {
-    player = new AB_ID_TT_Player();
+    player = new AB_ID_TT_Player(hash_mb, hash_file);
     std::cerr << "Created a new AB_ID_TT_Player" << std::endl;
   } else {
     std::cerr << "Player type not recognized or not implemented! Quitting." << std::endl;
@@ -0,0 +1,273 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include "../AB_ID_TT_Player.h"
+#include "Benchmark.h"
+
+/**
+ * The seed of every random number generator in a benchmark.
+ */
+static const unsigned int BENCHMARK_SEED = 20261018u;
+
+/**
+ * The starting position, then positions reached by random games with a
+ * fixed seed, from the opening to the last few moves. One has a promoted
+ * pawn.
+ */
+static const char *const CORPUS[] = {
+    "536870912 268435456 134217728 67108864 33554432 16777216 8388608 4194304 2097152 1048576 512 256 128 64 32 16 8 4 2 1 1 1 1072693248 1047552 300000",
+    "536870912 268435456 134217728 67108864 33554432 16777216 8388608 131072 0 1048576 512 256 128 64 1024 16 2097152 4 2 1 7 1 1066532864 5109800 300000",
+    "536870912 268435456 67108864 32768 33554432 16777216 8388608 131072 2097152 1048576 512 262144 128 2048 32 16 524288 4 2 1 11 1 934445056 138507592 300000",
+    "536870912 16777216 134217728 64 33554432 524288 8388608 4194304 65536 1048576 512 8192 128 0 1024 16 32768 4 2 1 12 2 42647 338057512 300000",
+    "268435456 8388608 134217728 67108864 33554432 16777216 0 4096 65536 1048576 512 256 128 2048 1024 16 0 4 2 1 13 1 529600512 544137320 300000",
+    "536870912 268435456 134217728 8192 33554432 16777216 8388608 131072 2097152 1048576 512 0 4096 0 32 0 8 524288 4 1 14 2 528941 71683538 300000",
+    "536870912 16777216 2097152 67108864 1048576 524288 8388608 262144 65536 0 512 0 128 32768 1024 16 16384 256 2 1 18 2 51091 440547436 300000",
+    "536870912 268435456 8388608 1024 0 16777216 262144 4194304 0 0 512 256 0 64 32 16 8 4 1048576 1 19 1 834929664 237762690 300000",
+    "536870912 268435456 134217728 0 32768 0 0 4194304 2097152 128 512 256 0 0 1024 16 67108864 64 32 1 20 2 67110769 60782606 300000",
+    "536870912 268435456 32 64 67108864 524288 8192 4194304 0 1048576 512 256 0 65536 1024 16 2097152 2 0 1 21 1 878190688 193386636 300000",
+    "536870912 268435456 131072 32768 134217728 16777216 0 262144 32 1048576 0 8192 128 0 0 16 0 512 2097152 1 25 1 957775904 113859918 300000",
+    "16384 8192 134217728 0 33554432 524288 256 0 0 0 512 0 128 0 1024 4 8 0 268435456 1 27 1 168321280 636983410 300000",
+    "536870912 268435456 2 0 1048576 16384 8388608 131072 1024 32768 512 8192 4096 0 32 0 67108864 0 128 64 32 2 67121888 191695133 300000",
+    "256 536870912 134217728 0 1048576 0 8388608 4194304 0 32768 0 0 4096 65536 1024 4 0 16384 524288 2 33 1 684753152 388377337 300000",
+    "16777216 65536 134217728 0 0 16384 8388608 0 131072 64 512 8192 4096 0 1024 2 0 32768 0 1 34 2 46595 914098620 300000",
+    "16384 536870912 8388608 0 67108864 512 0 0 2097152 1024 0 0 128 65536 32 0 0 0 16777216 1 35 1 614483456 442415454 300000",
+    "536870912 268435456 134217728 0 67108864 0 8388608 131072 1073741825 0 8192 0 0 2048 0 256 0 2097152 2 4 40 2 2107654 56481528 300000",
+};
+
+/**
+ * The number of random states probed by the random TTable benchmarks.
+ * Their buckets are spread all over the table, so once it is bigger than
+ * the cache nearly every probe misses.
+ */
+static const std::size_t RANDOM_PROBES = 1u << 20;
+
+/**
+ * How many probes ahead the prefetched benchmark fetches.
+ */
+static const std::size_t PREFETCH_DISTANCE = 8;
+
+Benchmark::Benchmark(int warmup, int repetitions, std::size_t hash_mb)
+    : warmup(warmup), repetitions(std::max(1, repetitions)), hash_mb(hash_mb), table(hash_mb) {
+  player.seed(BENCHMARK_SEED);
+}
+
+std::vector<std::string> Benchmark::corpus() {
+  return std::vector<std::string>(std::begin(CORPUS), std::end(CORPUS));
+}
+
+void Benchmark::run(const std::vector<std::string> &state_strings, bool json, std::ostream &out) {
+  // Eval and the ordered generator are protected members of Player
+  Player &engine = player;
+  std::vector<Position> positions;
+  for (const std::string &state_string : state_strings) {
+    positions.emplace_back(parse_input(state_string), zobrist_table);
+  }
+  // The table is probed with the hashes of the children, like the search does
+  std::vector<unsigned long long> hashes;
+  for (Position &position : positions) {
+    Move_List moves;
+    position.generate_moves(moves);
+    for (const Move &move : moves) {
+      position.do_move(move);
+      hashes.push_back(position.get_hash());
+      position.undo_move();
+    }
+  }
+
+  std::vector<unsigned long long> random_hashes(RANDOM_PROBES);
+  unsigned long long random_state = BENCHMARK_SEED;
+  for (unsigned long long &hash : random_hashes) {
+    hash = splitmix64(random_state);
+  }
+
+  std::vector<Benchmark_Result> results;
+  results.push_back(measure("generate_all_moves", [&]() {
+    unsigned long long operations = 0;
+    for (Position &position : positions) {
+      Move_List moves;
+      engine.generate_all_moves(position, moves);
+      sink += moves.size();
+      ++operations;
+    }
+    return operations;
+  }));
+  results.push_back(measure("Position::generate_moves", [&]() {
+    unsigned long long operations = 0;
+    for (Position &position : positions) {
+      Move_List moves;
+      position.generate_moves(moves);
+      sink += moves.size();
+      ++operations;
+    }
+    return operations;
+  }));
+  results.push_back(measure("eval", [&]() {
+    unsigned long long operations = 0;
+    for (const Position &position : positions) {
+      sink += engine.eval(position);
+      ++operations;
+    }
+    return operations;
+  }));
+  // The cached eval above hits every time after the first pass
+  results.push_back(measure("eval uncached", [&]() {
+    unsigned long long operations = 0;
+    for (const Position &position : positions) {
+      sink += engine.calculate_eval(position);
+      ++operations;
+    }
+    return operations;
+  }));
+  results.push_back(measure("do_move+undo_move", [&]() {
+    unsigned long long operations = 0;
+    for (Position &position : positions) {
+      Move_List moves;
+      position.generate_moves(moves);
+      for (const Move &move : moves) {
+        position.do_move(move);
+        sink += position.get_hash();
+        position.undo_move();
+      }
+      operations += moves.size();
+    }
+    return operations;
+  }));
+  results.push_back(measure("hash_state", [&]() {
+    unsigned long long operations = 0;
+    for (const Position &position : positions) {
+      sink += zobrist_table.hash_state(position.get_board());
+      ++operations;
+    }
+    return operations;
+  }));
+  results.push_back(measure("TTable::insert", [&]() {
+    TTable_Entry entry;
+    for (unsigned long long hash : hashes) {
+      entry.setHash(hash);
+      entry.setValue(static_cast<int>(hash & 0xffff));
+      entry.setDepth(static_cast<int>(hash >> 60));
+      entry.setValid(true);
+      table.insert(entry, hash);
+    }
+    return static_cast<unsigned long long>(hashes.size());
+  }));
+  results.push_back(measure("TTable::get_entry", [&]() {
+    for (unsigned long long hash : hashes) {
+      sink += table.get_entry(hash).getValue();
+    }
+    return static_cast<unsigned long long>(hashes.size());
+  }));
+  results.push_back(measure("TTable::get_entry random", [&]() {
+    for (unsigned long long hash : random_hashes) {
+      sink += table.get_entry(hash).getValue();
+    }
+    return static_cast<unsigned long long>(random_hashes.size());
+  }));
+  results.push_back(measure("TTable::get_entry prefetched", [&]() {
+    for (std::size_t i = 0; i < random_hashes.size(); ++i) {
+      table.prefetch(random_hashes[(i + PREFETCH_DISTANCE) % random_hashes.size()]);
+      sink += table.get_entry(random_hashes[i]).getValue();
+    }
+    return static_cast<unsigned long long>(random_hashes.size());
+  }));
+
+  for (const Benchmark_Result &result : results) {
+    report(result, json, out);
+  }
+}
+
+unsigned long long Benchmark::signature(const std::vector<std::string> &state_strings, int depth, bool prefetch,
+                                       std::ostream &out) {
+  using namespace std::chrono;
+  unsigned long long nodes = 0;
+  long long ms = 0;
+  for (std::size_t i = 0; i < state_strings.size(); ++i) {
+    AB_ID_TT_Player player(hash_mb);
+    player.seed(BENCHMARK_SEED);
+    player.set_depth_limit(depth);
+    player.set_prefetch(prefetch);
+    // Only the search is timed, not clearing the table
+    auto start = steady_clock::now();
+    std::string move_string = player.get_move_string(state_strings[i]);
+    ms += duration_cast<milliseconds>(steady_clock::now() - start).count();
+    out << "Position " << i + 1 << ": " << move_string << " " << player.get_number_of_nodes() << std::endl;
+    nodes += player.get_number_of_nodes();
+  }
+  out << "Nodes searched: " << nodes << std::endl;
+  out << "Time: " << ms << " ms" << std::endl;
+  out << "NPS: " << (ms ? nodes * 1000 / ms : nodes) << std::endl;
+  return nodes;
+}
+
+template <class Pass>
+Benchmark::Benchmark_Result Benchmark::measure(const std::string &name, Pass pass) {
+  using namespace std::chrono;
+  Benchmark_Result result;
+  result.name = name;
+
+  // Find how many passes fill a millisecond, which also warms up
+  int passes = 1;
+  for (;;) {
+    auto start = steady_clock::now();
+    for (int i = 0; i < passes; ++i) {
+      pass();
+    }
+    if (steady_clock::now() - start >= milliseconds(1) || passes >= (1 << 20)) {
+      break;
+    }
+    passes *= 2;
+  }
+  for (int i = 0; i < warmup * passes; ++i) {
+    pass();
+  }
+
+  for (int sample = 0; sample < repetitions; ++sample) {
+    unsigned long long operations = 0;
+    auto start = steady_clock::now();
+    for (int i = 0; i < passes; ++i) {
+      operations += pass();
+    }
+    double elapsed = duration_cast<nanoseconds>(steady_clock::now() - start).count();
+    result.operations = operations;
+    result.nanoseconds.push_back(operations ? elapsed / operations : 0.0);
+  }
+  return result;
+}
+
+void Benchmark::report(const Benchmark_Result &result, bool json, std::ostream &out) {
+  std::vector<double> sorted = result.nanoseconds;
+  std::sort(sorted.begin(), sorted.end());
+  // Nearest rank percentiles
+  auto percentile = [&sorted](double p) {
+    auto rank = static_cast<std::size_t>(std::ceil(p / 100.0 * sorted.size()));
+    return sorted[rank ? rank - 1 : 0];
+  };
+  double mean = std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size();
+
+  std::ostringstream line;
+  line << std::fixed << std::setprecision(2);
+  if (json) {
+    line << "{\"benchmark\":\"" << result.name << "\""
+         << ",\"operations_per_sample\":" << result.operations
+         << ",\"samples\":" << sorted.size()
+         << ",\"unit\":\"ns/op\""
+         << ",\"min\":" << sorted.front()
+         << ",\"p50\":" << percentile(50)
+         << ",\"p90\":" << percentile(90)
+         << ",\"p99\":" << percentile(99)
+         << ",\"max\":" << sorted.back()
+         << ",\"mean\":" << mean << "}";
+  } else {
+    line << std::left << std::setw(30) << result.name << std::right
+         << " min " << std::setw(9) << sorted.front()
+         << " p50 " << std::setw(9) << percentile(50)
+         << " p90 " << std::setw(9) << percentile(90)
+         << " p99 " << std::setw(9) << percentile(99)
+         << " max " << std::setw(9) << sorted.back()
+         << " ns/op";
+  }
+  out << line.str() << std::endl;
+}
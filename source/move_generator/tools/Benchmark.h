@@ -0,0 +1,100 @@
+#ifndef MOVE_GENERATOR_BENCHMARK_H
+#define MOVE_GENERATOR_BENCHMARK_H
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include "../AB_ID_Player.h"
+#include "../Zobrist_Table.h"
+#include "../TTable.h"
+
+/**
+ * Times the pieces of the search one at a time: move generation, eval,
+ * making moves, hashing and the transposition table. Each is run over a
+ * corpus of positions, first a few times to warm up the caches and then
+ * repeatedly, and the time per operation is reported as percentiles over
+ * the repetitions.
+ *
+ * signature searches the corpus to a fixed depth instead, with a fixed
+ * seed for move ordering, so that the number of nodes it searches only
+ * changes when the search itself does. A change that should only make the
+ * engine faster must leave the node count alone.
+ */
+class Benchmark {
+public:
+  /**
+   * @param warmup The number of untimed samples before each benchmark.
+   * @param repetitions The number of timed samples of each benchmark.
+   * @param hash_mb The size of the transposition tables, in megabytes.
+   */
+  Benchmark(int warmup, int repetitions, std::size_t hash_mb = TTABLE_DEFAULT_MB);
+
+  /**
+   * Run every benchmark over the states and write one line per benchmark.
+   *
+   * @param state_strings
+   * @param json Write each line as a JSON object instead of a table row.
+   * @param out
+   */
+  void run(const std::vector<std::string> &state_strings, bool json, std::ostream &out);
+
+  /**
+   * Search every state to a fixed depth with the transposition table
+   * player, a new one for each state, and write the best move and the
+   * nodes searched for each, then the total.
+   *
+   * @param state_strings
+   * @param depth
+   * @param prefetch Prefetch the table entries of children, see AB_ID_TT_Player::set_prefetch.
+   * @param out
+   * @return The total number of nodes searched.
+   */
+  unsigned long long signature(const std::vector<std::string> &state_strings, int depth, bool prefetch,
+                               std::ostream &out);
+
+  /**
+   * @return The built in corpus: the starting position and positions from
+   *         random games at every stage of the game.
+   */
+  static std::vector<std::string> corpus();
+
+private:
+  struct Benchmark_Result {
+    std::string name;
+    unsigned long long operations{0ull};
+    std::vector<double> nanoseconds;
+  };
+
+  /**
+   * Time a benchmark. One sample runs pass, which does some number of
+   * operations over the whole corpus and returns how many, as many times as
+   * it takes to fill a millisecond.
+   *
+   * @param name
+   * @param pass
+   * @return The time per operation of each sample.
+   */
+  template <class Pass>
+  Benchmark_Result measure(const std::string &name, Pass pass);
+
+  void report(const Benchmark_Result &result, bool json, std::ostream &out);
+
+  /**
+   * The player whose eval and move generation are timed. Benchmark is a
+   * friend of Player to reach them; the player never searches.
+   */
+  AB_ID_Player player;
+  Zobrist_Table zobrist_table;
+  int warmup;
+  int repetitions;
+  std::size_t hash_mb;
+  TTable table;
+  /**
+   * Everything the benchmarks compute is folded in here so that none of it
+   * can be optimized away.
+   */
+  unsigned long long sink{0ull};
+};
+
+
+#endif //MOVE_GENERATOR_BENCHMARK_H
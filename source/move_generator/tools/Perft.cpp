@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include "Perft.h"
+
+Perft::Perft(std::size_t hash_mb, bool bulk, int threads, int split_plies)
+    : bulk(bulk), threads(threads), split_plies(split_plies) {
+  if (this->threads < 1) {
+    this->threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  std::size_t entries = (hash_mb << 20) / sizeof(Perft_Entry);
+  if (entries) {
+    // Round down to a power of two so the hash can be masked into an index
+    while (entries & (entries - 1)) {
+      entries &= entries - 1;
+    }
+    table.reset(new Perft_Entry[entries]);
+    mask = entries - 1;
+  }
+}
+
+unsigned long long Perft::run(const std::string &state_string, int depth, bool divide, std::ostream &out) {
+  Board root_state = parse_input(state_string);
+  Position root_position(root_state, zobrist_table);
+  if (depth < 1 || is_terminal(root_state)) {
+    unsigned long long nodes = perft(root_position, depth);
+    out << "Nodes: " << nodes << std::endl;
+    return nodes;
+  }
+
+  // Split the tree into subtrees below the first or second ply
+  Move_List root_moves;
+  root_position.generate_moves(root_moves);
+  std::vector<Perft_Work> work;
+  for (std::size_t i = 0; i < root_moves.size(); ++i) {
+    Perft_Work subtree;
+    subtree.moves[0] = root_moves[i];
+    subtree.plies = 1;
+    subtree.root_move = static_cast<int>(i);
+    root_position.do_move(root_moves[i]);
+    if (split_plies < 2 || depth < 2 || is_terminal(root_position.get_board())) {
+      work.push_back(subtree);
+    } else {
+      Move_List replies;
+      root_position.generate_moves(replies);
+      subtree.plies = 2;
+      for (const Move &reply : replies) {
+        subtree.moves[1] = reply;
+        work.push_back(subtree);
+      }
+    }
+    root_position.undo_move();
+  }
+
+  struct Thread_Count {
+    unsigned long long nodes{0ull};
+    int subtrees{0};
+    long long milliseconds{0ll};
+  };
+  std::vector<unsigned long long> work_nodes(work.size(), 0ull);
+  std::vector<Thread_Count> thread_counts(threads);
+  std::atomic<std::size_t> next_work{0};
+
+  auto count_subtrees = [&](int thread) {
+    auto start = std::chrono::steady_clock::now();
+    Position position = root_position;
+    Thread_Count &count = thread_counts[thread];
+    for (std::size_t i = next_work++; i < work.size(); i = next_work++) {
+      const Perft_Work &subtree = work[i];
+      for (int ply = 0; ply < subtree.plies; ++ply) {
+        position.do_move(subtree.moves[ply]);
+      }
+      work_nodes[i] = perft(position, depth - subtree.plies);
+      for (int ply = 0; ply < subtree.plies; ++ply) {
+        position.undo_move();
+      }
+      count.nodes += work_nodes[i];
+      ++count.subtrees;
+    }
+    count.milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count();
+  };
+
+  std::vector<std::thread> helpers;
+  for (int thread = 1; thread < threads; ++thread) {
+    helpers.emplace_back(count_subtrees, thread);
+  }
+  count_subtrees(0);
+  for (std::thread &helper : helpers) {
+    helper.join();
+  }
+
+  std::vector<unsigned long long> root_nodes(root_moves.size(), 0ull);
+  for (std::size_t i = 0; i < work.size(); ++i) {
+    root_nodes[work[i].root_move] += work_nodes[i];
+  }
+  unsigned long long nodes = 0;
+  for (std::size_t i = 0; i < root_moves.size(); ++i) {
+    if (divide) {
+      out << to_move_string(root_state, root_moves[i]) << ": " << root_nodes[i] << std::endl;
+    }
+    nodes += root_nodes[i];
+  }
+  if (threads > 1) {
+    for (int thread = 0; thread < threads; ++thread) {
+      out << "Thread " << thread << ": " << thread_counts[thread].subtrees << " subtrees, "
+          << thread_counts[thread].nodes << " nodes, " << thread_counts[thread].milliseconds << " ms" << std::endl;
+    }
+  }
+  out << "Nodes: " << nodes << std::endl;
+  return nodes;
+}
+
+unsigned long long Perft::perft(Position &position, int depth) {
+  const Board &state = position.get_board();
+  if (depth == 0 || is_terminal(state)) {
+    return 1;
+  }
+  if (bulk && depth == 1) {
+    return position.count_moves();
+  }
+
+  // The hash doesn't include the depth or the move number, which decides
+  // when the game ends, so they are mixed into the key
+  unsigned long long key = position.get_hash()
+                           ^ ((static_cast<unsigned long long>(state[MOVE_NUMBER]) << 8 | depth)
+                              * 0x9E3779B97F4A7C15ull);
+  Perft_Entry *entry = table ? &table[key & mask] : nullptr;
+  if (entry) {
+    unsigned long long nodes = entry->nodes.load(std::memory_order_relaxed);
+    if ((entry->check.load(std::memory_order_relaxed) ^ nodes) == key) {
+      return nodes;
+    }
+  }
+
+  unsigned long long nodes = 0;
+  Move_List moves;
+  position.generate_moves(moves);
+  for (const Move &move : moves) {
+    position.do_move(move);
+    nodes += perft(position, depth - 1);
+    position.undo_move();
+  }
+
+  if (entry) {
+    entry->check.store(key ^ nodes, std::memory_order_relaxed);
+    entry->nodes.store(nodes, std::memory_order_relaxed);
+  }
+  return nodes;
+}
@@ -0,0 +1,78 @@
+#ifndef MOVE_GENERATOR_PERFT_H
+#define MOVE_GENERATOR_PERFT_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "../Position.h"
+#include "../Zobrist_Table.h"
+
+/**
+ * Counts the leaf nodes of the game tree to a fixed depth, to validate the
+ * move generator and measure its speed. A finished game is a leaf however
+ * shallow it is.
+ *
+ * Nothing is evaluated and the moves aren't ordered. At the last ply the
+ * moves are counted rather than made (bulk counting), and subtrees can be
+ * cached by hash so that transpositions are only counted once.
+ *
+ * The subtrees below the root moves, or below the replies to them when the
+ * split is two plies, are shared out between threads. Each thread takes the
+ * next unclaimed subtree until there are none left, and the threads share
+ * the cache without locking.
+ */
+class Perft {
+public:
+  /**
+   * @param hash_mb The size of the subtree cache in megabytes, 0 for none.
+   * @param bulk Count the moves at the last ply instead of making them.
+   * @param threads The number of threads to count with, 0 for one per core.
+   * @param split_plies Share out the subtrees below the first (1) or second (2) ply.
+   */
+  Perft(std::size_t hash_mb, bool bulk, int threads = 1, int split_plies = 1);
+
+  /**
+   * @param state_string
+   * @param depth
+   * @param divide Write the leaf count below each root move to out.
+   * @param out
+   * @return The number of leaves.
+   */
+  unsigned long long run(const std::string &state_string, int depth, bool divide, std::ostream &out);
+
+private:
+  /**
+   * A cache entry. The check word is the key xor the node count, so an
+   * entry torn by two threads writing it at once fails the check instead of
+   * returning the wrong count.
+   */
+  struct Perft_Entry {
+    std::atomic<unsigned long long> check{0ull};
+    std::atomic<unsigned long long> nodes{0ull};
+  };
+
+  /**
+   * A subtree to count: the moves from the root that lead to it, and the
+   * root move it is counted under.
+   */
+  struct Perft_Work {
+    Move moves[2];
+    int plies{0};
+    int root_move{0};
+  };
+
+  unsigned long long perft(Position &position, int depth);
+
+  Zobrist_Table zobrist_table;
+  bool bulk;
+  int threads;
+  int split_plies;
+  std::unique_ptr<Perft_Entry[]> table;
+  unsigned long long mask{0ull};
+};
+
+
+#endif //MOVE_GENERATOR_PERFT_H
@@ -0,0 +1,89 @@
+/**
+ * Time move generation, eval, making moves, hashing and the transposition
+ * table over a corpus of positions.
+ *
+ *     bench [--warmup N] [--repetitions N] [--json] [--hash-mb MB] [STATE | -]
+ *     bench --signature [--depth N] [--hash-mb MB] [--no-prefetch] [STATE | -]
+ *
+ * Without a STATE the built in corpus is used. "-" reads one state per line
+ * from stdin. --json writes one JSON object per benchmark instead of a table.
+ *
+ * --signature searches each state to a fixed depth with fixed seeds and
+ * prints the total number of nodes searched, which is the same on every run
+ * until the search changes, and the NPS.
+ *
+ * --hash-mb sizes the transposition tables. Comparing the random probe
+ * benchmarks, or the signature NPS with and without --no-prefetch, with a
+ * table much bigger than the last level cache shows what prefetching the
+ * table saves.
+ * Mike Lane
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include "Benchmark.h"
+
+static int usage() {
+  std::cerr << "usage: bench [--warmup N] [--repetitions N] [--json] [--hash-mb MB] [STATE | -]" << std::endl;
+  std::cerr << "       bench --signature [--depth N] [--hash-mb MB] [--no-prefetch] [STATE | -]" << std::endl;
+  return 1;
+}
+
+int main(int argc, char **argv) {
+  int warmup = 3;
+  int repetitions = 50;
+  bool json = false;
+  bool signature = false;
+  bool prefetch = true;
+  int depth = 7;
+  std::size_t hash_mb = TTABLE_DEFAULT_MB;
+  std::string state_string;
+
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--json")) {
+      json = true;
+    } else if (!strcmp(argv[i], "--signature")) {
+      signature = true;
+    } else if (!strcmp(argv[i], "--no-prefetch")) {
+      prefetch = false;
+    } else if (!strcmp(argv[i], "--depth") && i + 1 < argc) {
+      depth = std::atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--hash-mb") && i + 1 < argc) {
+      hash_mb = std::strtoul(argv[++i], nullptr, 10);
+    } else if (!strcmp(argv[i], "--warmup") && i + 1 < argc) {
+      warmup = std::atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--repetitions") && i + 1 < argc) {
+      repetitions = std::atoi(argv[++i]);
+    } else if (argv[i][0] == '-' && argv[i][1] == '-') {
+      return usage();
+    } else {
+      state_string += state_string.empty() ? argv[i] : std::string(" ") + argv[i];
+    }
+  }
+
+  std::vector<std::string> state_strings;
+  if (state_string == "-") {
+    while (std::getline(std::cin, state_string)) {
+      if (!state_string.empty()) {
+        state_strings.push_back(state_string);
+      }
+    }
+  } else if (!state_string.empty()) {
+    state_strings.push_back(state_string);
+  } else {
+    state_strings = Benchmark::corpus();
+  }
+  if (state_strings.empty()) {
+    return usage();
+  }
+
+  Benchmark benchmark(warmup, repetitions, hash_mb);
+  if (signature) {
+    benchmark.signature(state_strings, depth, prefetch, std::cout);
+  } else {
+    benchmark.run(state_strings, json, std::cout);
+  }
+  return 0;
+}
@@ -0,0 +1,82 @@
+/**
+ * Count the leaves of the game tree below a state, to validate and
+ * benchmark the move generator.
+ *
+ *     perft [--divide] [--hash MB] [--no-bulk] [--threads N] [--split PLIES] DEPTH [STATE]
+ *
+ * STATE is the space separated list of integers the front end sends, or
+ * "-" to read one state per line from stdin. Without a STATE the starting
+ * position is used. --threads 0 uses one thread per core, and --split 2
+ * shares out the subtrees below the second ply instead of the first, which
+ * balances the threads better when there are few root moves.
+ * Mike Lane
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include "Perft.h"
+
+static const char *const START_STATE =
+    "536870912 268435456 134217728 67108864 33554432 16777216 8388608 4194304 2097152 1048576 "
+    "512 256 128 64 32 16 8 4 2 1 1 1 1072693248 1047552 300000";
+
+static int usage() {
+  std::cerr << "usage: perft [--divide] [--hash MB] [--no-bulk] [--threads N] [--split PLIES] DEPTH [STATE]"
+            << std::endl;
+  return 1;
+}
+
+int main(int argc, char **argv) {
+  bool divide = false;
+  bool bulk = true;
+  std::size_t hash_mb = 0;
+  int threads = 1;
+  int split_plies = 1;
+  int depth = -1;
+  std::string state_string;
+
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--divide")) {
+      divide = true;
+    } else if (!strcmp(argv[i], "--no-bulk")) {
+      bulk = false;
+    } else if (!strcmp(argv[i], "--hash") && i + 1 < argc) {
+      hash_mb = std::strtoul(argv[++i], nullptr, 10);
+    } else if (!strcmp(argv[i], "--threads") && i + 1 < argc) {
+      threads = std::atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--split") && i + 1 < argc) {
+      split_plies = std::atoi(argv[++i]);
+    } else if (depth < 0) {
+      depth = std::atoi(argv[i]);
+    } else {
+      state_string += state_string.empty() ? argv[i] : std::string(" ") + argv[i];
+    }
+  }
+  if (depth < 0) {
+    return usage();
+  }
+
+  Perft perft(hash_mb, bulk, threads, split_plies);
+  unsigned long long total_nodes = 0;
+  auto start = std::chrono::steady_clock::now();
+
+  if (state_string == "-") {
+    while (std::getline(std::cin, state_string)) {
+      if (!state_string.empty()) {
+        total_nodes += perft.run(state_string, depth, divide, std::cout);
+      }
+    }
+  } else {
+    total_nodes += perft.run(state_string.empty() ? START_STATE : state_string, depth, divide, std::cout);
+  }
+
+  auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+  long long ms = elapsed.count();
+  std::cout << "Total nodes: " << total_nodes << std::endl;
+  std::cout << "Time: " << ms << " ms" << std::endl;
+  std::cout << "NPS: " << (ms ? total_nodes * 1000 / ms : total_nodes) << std::endl;
+  return 0;
+}